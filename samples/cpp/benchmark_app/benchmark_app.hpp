@@ -65,6 +65,23 @@ static const char cache_dir_message[] = "Optional. Enables caching of loaded mod
 static const char load_from_file_message[] = "Optional. Loads model from file directly without read_model."
                                              " All CNNNetwork options (like re-shape) will be ignored";
 
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Enables the open-loop load generation: the requests arrive at the target rate given by -qps "
+    "independently of the completion of the previous ones, so the reported latency includes the time the request "
+    "waits for an idle infer request. Supported values: \"poisson\" (exponentially distributed inter-arrival times) "
+    "and \"constant\" (equal inter-arrival times). If not specified, the requests are started closed-loop.";
+
+/// @brief message for open-loop target rates
+static const char qps_message[] =
+    "Optional. Comma separated list of the target arrival rates (requests per second) for the open-loop mode, "
+    "e.g. \"50,100,200\". Every rate runs for the duration given by -t or for the number of requests given by -niter.";
+
+/// @brief message for latency SLO
+static const char slo_message[] =
+    "Optional. The latency SLO in milliseconds for the open-loop mode. The 99th percentile of the latency of every "
+    "target rate is checked against it and the highest rate meeting the SLO (the knee point) is reported.";
+
 /// @brief message for maximum inference rate
 static const char maximum_inference_rate_message[] =
     "Optional. Maximum inference rate by frame per second"
@@ -226,6 +243,11 @@ static const char pcseq_message[] = "Optional. Report latencies for each shape i
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for latency_histograms option
+static const char latency_histograms_message[] =
+    "Optional. Path to a file where to store the per-node latency histograms collected across the inferences. "
+    "Supported only by the CPU device. The nodes with the highest 99th percentile of the execution time are printed.";
+
 // @brief message for dump config option
 static const char dump_config_message[] =
     "Optional. Path to JSON file to dump OV parameters, which were set by application.";
@@ -317,6 +339,15 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Open-loop arrival process
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Open-loop target arrival rates
+DEFINE_string(qps, "", qps_message);
+
+/// @brief Latency SLO for the open-loop mode
+DEFINE_double(slo, 0, slo_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -378,6 +409,9 @@ DEFINE_bool(pcseq, false, pcseq_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Path to a file where to store the per-node latency histograms
+DEFINE_string(latency_histograms, "", latency_histograms_message);
+
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
 
@@ -403,6 +437,9 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival  <string>            " << arrival_message << std::endl;
+    std::cout << "    -qps  <string>                " << qps_message << std::endl;
+    std::cout << "    -slo  <float>                 " << slo_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
@@ -443,6 +480,7 @@ static void show_usage() {
     std::cout << "    -pcsort                 " << pc_sort_message << std::endl;
     std::cout << "    -pcseq                  " << pcseq_message << std::endl;
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
+    std::cout << "    -latency_histograms     " << latency_histograms_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
     std::cout << "    -load_config            " << load_config_message << std::endl;
 }
@@ -50,6 +50,12 @@ public:
         _request.start_async();
     }
 
+    /// @brief Starts the request that arrived at arrival_time, so its latency includes the time it was queued
+    void start_async(Time::time_point arrival_time) {
+        _startTime = arrival_time;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
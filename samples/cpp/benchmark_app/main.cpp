@@ -4,8 +4,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <random>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <utility>
@@ -152,6 +155,25 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
                 "Number of iterations should be greater than number of infer requests when using sync API.");
         }
     }
+    if (!FLAGS_arrival.empty()) {
+        if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+            throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson` or `constant`.");
+        }
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop load generation (-arrival option) requires async API.");
+        }
+        if (FLAGS_qps.empty()) {
+            throw std::logic_error("Open-loop load generation (-arrival option) requires target rates set by -qps.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-arrival and -max_irate options can't be used together.");
+        }
+    } else if (!FLAGS_qps.empty()) {
+        throw std::logic_error("-qps option is supported only for open-loop load generation (-arrival option).");
+    }
+    if (FLAGS_slo < 0) {
+        throw std::logic_error("-slo option should be non-negative.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -328,6 +350,59 @@ void fuse_mean_scale(ov::preprocess::PrePostProcessor& preproc, const benchmark_
         }
     }
 }
+
+/**
+ * @brief Prints the nodes with the highest 99th percentile of the execution time from the CPU latency histograms
+ * dump, which is a ';' separated table with the header line
+ */
+void print_latency_histograms_summary(const std::string& histograms, size_t top = 10) {
+    struct NodeLatency {
+        std::vector<std::string> fields;
+        double p99;
+    };
+    std::istringstream lines(histograms);
+    std::string line;
+    std::getline(lines, line);
+    std::vector<std::string> header;
+    std::istringstream header_stream(line);
+    for (std::string field; std::getline(header_stream, field, ';');) {
+        header.push_back(field);
+    }
+    const auto column = [&header](const std::string& name) {
+        return static_cast<size_t>(std::find(header.begin(), header.end(), name) - header.begin());
+    };
+    const size_t name = column("node_name"), type = column("node_type"), stage = column("stage"),
+                 count = column("count"), p50 = column("p50_us"), p99 = column("p99_us"), p999 = column("p99.9_us");
+    if (std::max({name, type, stage, count, p50, p99, p999}) >= header.size()) {
+        slog::warn << "Unknown format of the latency histograms" << slog::endl;
+        return;
+    }
+
+    std::vector<NodeLatency> nodes;
+    while (std::getline(lines, line)) {
+        NodeLatency node;
+        std::istringstream line_stream(line);
+        for (std::string field; std::getline(line_stream, field, ';');) {
+            node.fields.push_back(field);
+        }
+        if (node.fields.size() < header.size() - 1 || node.fields[stage] != "execute") {
+            continue;
+        }
+        node.p99 = std::stod(node.fields[p99]);
+        nodes.push_back(std::move(node));
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const NodeLatency& lhs, const NodeLatency& rhs) {
+        return lhs.p99 > rhs.p99;
+    });
+    nodes.resize(std::min(nodes.size(), top));
+
+    slog::info << "Nodes with the highest 99th percentile of the execution time:" << slog::endl;
+    for (const auto& node : nodes) {
+        slog::info << "    " << node.fields[name] << " (" << node.fields[type] << "): count " << node.fields[count]
+                   << ", p50 " << node.fields[p50] << " us, p99 " << node.fields[p99] << " us, p99.9 "
+                   << node.fields[p999] << " us" << slog::endl;
+    }
+}
 }  // namespace
 
 /**
@@ -500,6 +575,14 @@ int main(int argc, char* argv[]) {
             }
             perf_counts = (device_config.at(ov::enable_profiling.name()).as<bool>()) ? true : perf_counts;
 
+            if (!FLAGS_latency_histograms.empty()) {
+                if (device == "CPU") {
+                    device_config["CPU_LATENCY_HISTOGRAMS"] = true;
+                } else {
+                    slog::warn << "Latency histograms are not supported by " << device << " device." << slog::endl;
+                }
+            }
+
             auto supported_properties = core.get_property(device, ov::supported_properties);
 
             auto supported = [&](const std::string& key) {
@@ -1223,46 +1306,110 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        auto prepare_request = [&](const InferReqWrap::Ptr& request, size_t iteration_id) {
+            if (inferenceOnly) {
+                return;
+            }
+            auto inputs = app_inputs_info[iteration_id % app_inputs_info.size()];
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+            if (FLAGS_pcseq) {
+                request->set_latency_group_id(iteration_id % app_inputs_info.size());
             }
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
-                }
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration_id % inputsData.at(inputName).size()];
+                request->set_tensor(inputName, data);
+            }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+            if (useGpuMem) {
+                auto outputTensors = ::gpu::get_remote_output_tensors(compiledModel, request->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    request->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
+            }
+        };
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
-                }
+        size_t processedFramesN = 0;
+        auto startTime = Time::now();
+        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+        std::vector<OpenLoopMetrics> openLoopResults;
+        double sloKneeQps = 0;
+        auto log_open_loop_step = [](const OpenLoopMetrics& metrics) {
+            slog::info << "Target " << double_to_string(metrics.target_qps) << " QPS: achieved "
+                       << double_to_string(metrics.achieved_qps) << " QPS, p50 "
+                       << double_to_string(metrics.latency.p50) << " ms, p99 " << double_to_string(metrics.latency.p99)
+                       << " ms, p99.9 " << double_to_string(metrics.latency.p99_9) << " ms, average queue time "
+                       << double_to_string(metrics.avg_queue_time) << " ms"
+                       << (FLAGS_slo > 0 ? (metrics.slo_met ? ", SLO met" : ", SLO violated") : "") << slog::endl;
+        };
+        if (!FLAGS_arrival.empty()) {
+            /** Open-loop: the requests arrive on schedule regardless of the completions, a request that finds
+             * no idle infer request waits for one and the wait is counted in its latency **/
+            // the fixed seed keeps the arrival schedule reproducible between runs
+            std::mt19937_64 generator(0);
+            bool sloViolated = false;
+            for (const auto rate : parse_target_rates(FLAGS_qps)) {
+                inferRequestsQueue.reset_times();
+                iteration = 0;
+                processedFramesN = 0;
+                execTime = 0;
+                double queueTime = 0;
+                std::exponential_distribution<double> interArrival(rate);
+                const auto stepStartTime = Time::now();
+                auto arrivalTime = stepStartTime;
+                while ((niter != 0LL && iteration < niter) ||
+                       (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds)) {
+                    std::this_thread::sleep_until(arrivalTime);
+                    inferRequest = inferRequestsQueue.get_idle_request();
+                    if (!inferRequest) {
+                        OPENVINO_THROW("No idle Infer Requests!");
                     }
+                    queueTime += std::chrono::duration_cast<ns>(Time::now() - arrivalTime).count() * 0.000001;
+                    prepare_request(inferRequest, iteration);
+                    inferRequest->start_async(arrivalTime);
+                    ++iteration;
+                    processedFramesN += batchSize;
+
+                    const double interval = FLAGS_arrival == "poisson" ? interArrival(generator) : 1.0 / rate;
+                    arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                    execTime = std::chrono::duration_cast<ns>(arrivalTime - stepStartTime).count();
                 }
+                inferRequestsQueue.wait_all();
+
+                OpenLoopMetrics metrics;
+                metrics.target_qps = rate;
+                metrics.achieved_qps = 1000.0 * iteration / inferRequestsQueue.get_duration_in_milliseconds();
+                metrics.latency = LatencyMetrics(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+                metrics.avg_queue_time = iteration ? queueTime / iteration : 0;
+                metrics.slo_met = FLAGS_slo <= 0 || metrics.latency.p99 <= FLAGS_slo;
+                if (!metrics.slo_met) {
+                    sloViolated = true;
+                } else if (!sloViolated) {
+                    sloKneeQps = rate;
+                }
+                log_open_loop_step(metrics);
+                openLoopResults.push_back(metrics);
+            }
+        }
+
+        /** Start inference & calculate performance **/
+        /** to align number if iterations to guarantee that last infer requests are
+         * executed in the same conditions **/
+        while (FLAGS_arrival.empty() &&
+               ((niter != 0LL && iteration < niter) ||
+                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                (FLAGS_api == "async" && iteration % nireq != 0))) {
+            inferRequest = inferRequestsQueue.get_idle_request();
+            if (!inferRequest) {
+                OPENVINO_THROW("No idle Infer Requests!");
             }
+            prepare_request(inferRequest, iteration);
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
@@ -1334,6 +1481,21 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            for (const auto& metrics : openLoopResults) {
+                statistics->add_parameters(StatisticsReport::Category::OPEN_LOOP_RESULTS,
+                                           {StatisticsVariant("Open-loop results", "open_loop_results", metrics)});
+            }
+            if (!openLoopResults.empty()) {
+                // the execution results above are of the last target rate, the other rates are in the open-loop results
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           {StatisticsVariant("execution results target QPS",
+                                                              "execution_results_target_qps",
+                                                              openLoopResults.back().target_qps)});
+            }
+            if (!openLoopResults.empty() && FLAGS_slo > 0) {
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           {StatisticsVariant("SLO knee QPS", "slo_knee_qps", sloKneeQps)});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1353,6 +1515,18 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (!FLAGS_latency_histograms.empty()) {
+            try {
+                const auto histograms = compiledModel.get_property("CPU_LATENCY_HISTOGRAMS_DUMP").as<std::string>();
+                std::ofstream histograms_file(FLAGS_latency_histograms);
+                histograms_file << histograms;
+                slog::info << "Latency histograms are stored to " << FLAGS_latency_histograms << slog::endl;
+                print_latency_histograms_summary(histograms);
+            } catch (const std::exception& ex) {
+                slog::err << "Can't get latency histograms: " << ex.what() << slog::endl;
+            }
+        }
+
         if (perf_counts) {
             std::vector<std::vector<ov::ProfilingInfo>> perfCounts;
             for (size_t ireq = 0; ireq < nireq; ireq++) {
@@ -1385,6 +1559,15 @@ int main(int argc, char* argv[]) {
         } catch (const ov::Exception&) {
         }
 
+        if (!openLoopResults.empty()) {
+            // the counters are reset for every target rate, so the general report covers the last one only
+            slog::info << "Open-loop results:" << slog::endl;
+            for (const auto& metrics : openLoopResults) {
+                log_open_loop_step(metrics);
+            }
+            slog::info << "The count, duration, latency and throughput below are of the last target rate ("
+                       << double_to_string(openLoopResults.back().target_qps) << " QPS)" << slog::endl;
+        }
         slog::info << "Count:               " << iteration << " iterations" << slog::endl;
         slog::info << "Duration:            " << double_to_string(totalDuration) << " ms" << slog::endl;
 
@@ -1411,6 +1594,15 @@ int main(int argc, char* argv[]) {
         }
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
+        if (!openLoopResults.empty() && FLAGS_slo > 0) {
+            if (sloKneeQps > 0) {
+                slog::info << "SLO knee:            " << double_to_string(sloKneeQps) << " QPS (p99 latency <= "
+                           << double_to_string(FLAGS_slo) << " ms)" << slog::endl;
+            } else {
+                slog::info << "SLO knee:            p99 latency exceeds " << double_to_string(FLAGS_slo)
+                           << " ms at every target rate" << slog::endl;
+            }
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
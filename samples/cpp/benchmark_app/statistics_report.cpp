@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <iomanip>
 #include <map>
 #include <string>
 #include <utility>
@@ -26,7 +27,7 @@ void StatisticsReport::dump() {
 
     auto dump_parameters = [&dumper](const Parameters& parameters) {
         for (auto& parameter : parameters) {
-            if (parameter.type != StatisticsVariant::METRICS) {
+            if (parameter.type != StatisticsVariant::METRICS && parameter.type != StatisticsVariant::OPEN_LOOP) {
                 dumper << parameter.csv_name;
             }
             dumper << parameter.to_string();
@@ -67,6 +68,16 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::OPEN_LOOP_RESULTS)) {
+        dumper << "Open-loop results";
+        dumper.endLine();
+        dumper << "Target QPS;Achieved QPS;p50 (ms);p90 (ms);p99 (ms);p99.9 (ms);Average queue time (ms);SLO met";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::OPEN_LOOP_RESULTS));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -212,6 +223,9 @@ void StatisticsReportJSON::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
     }
+    if (_parameters.count(Category::OPEN_LOOP_RESULTS)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::OPEN_LOOP_RESULTS));
+    }
 
     std::ofstream out_stream(name);
     out_stream << std::setw(4) << js << std::endl;
@@ -328,6 +342,19 @@ static nlohmann::json to_json(const LatencyMetrics& latenct_metrics) {
     return stat;
 }
 
+static nlohmann::json to_json(const OpenLoopMetrics& open_loop_metrics) {
+    nlohmann::json stat;
+    stat["target_qps"] = open_loop_metrics.target_qps;
+    stat["achieved_qps"] = open_loop_metrics.achieved_qps;
+    stat["latency_p50"] = open_loop_metrics.latency.p50;
+    stat["latency_p90"] = open_loop_metrics.latency.p90;
+    stat["latency_p99"] = open_loop_metrics.latency.p99;
+    stat["latency_p99_9"] = open_loop_metrics.latency.p99_9;
+    stat["queue_time_average"] = open_loop_metrics.avg_queue_time;
+    stat["slo_met"] = open_loop_metrics.slo_met;
+    return stat;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
@@ -338,11 +365,20 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case OPEN_LOOP: {
+        std::ostringstream str;
+        str << std::fixed << std::setprecision(2) << open_loop_val.target_qps << ";" << open_loop_val.achieved_qps
+            << ";" << open_loop_val.latency.p50 << ";" << open_loop_val.latency.p90 << ";"
+            << open_loop_val.latency.p99 << ";" << open_loop_val.latency.p99_9 << ";" << open_loop_val.avg_queue_time
+            << ";" << (open_loop_val.slo_met ? "YES" : "NO");
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -367,6 +403,13 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(to_json(metrics_val));
     } break;
+    case OPEN_LOOP: {
+        auto& arr = js[json_name];
+        if (arr.empty()) {
+            arr = nlohmann::json::array();
+        }
+        arr.push_back(to_json(open_loop_val));
+    } break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
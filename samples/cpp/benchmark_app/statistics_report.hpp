@@ -30,9 +30,19 @@ static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 static constexpr char sortDetailedCntReport[] = "sort_detailed_counters";
 
+/// @brief Results of the open-loop run at one target arrival rate
+struct OpenLoopMetrics {
+    double target_qps = 0;
+    double achieved_qps = 0;
+    // the latency includes the time the request waits for an idle infer request
+    LatencyMetrics latency;
+    double avg_queue_time = 0;
+    bool slo_met = true;
+};
+
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, OPEN_LOOP };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -69,6 +79,11 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const OpenLoopMetrics& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          open_loop_val(v),
+          type(OPEN_LOOP) {}
 
     ~StatisticsVariant() {}
 
@@ -79,6 +94,7 @@ public:
     unsigned long long ull_val = 0;
     std::string s_val;
     LatencyMetrics metrics_val;
+    OpenLoopMetrics open_loop_val;
     Type type;
 
     std::string to_string() const;
@@ -96,7 +112,13 @@ public:
         std::string report_folder;
     };
 
-    enum class Category { COMMAND_LINE_PARAMETERS, RUNTIME_CONFIG, EXECUTION_RESULTS, EXECUTION_RESULTS_GROUPPED };
+    enum class Category {
+        COMMAND_LINE_PARAMETERS,
+        RUNTIME_CONFIG,
+        EXECUTION_RESULTS,
+        EXECUTION_RESULTS_GROUPPED,
+        OPEN_LOOP_RESULTS
+    };
 
     virtual ~StatisticsReport() = default;
 
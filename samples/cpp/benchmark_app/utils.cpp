@@ -97,6 +97,28 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+std::vector<double> parse_target_rates(const std::string& rates_string) {
+    std::vector<double> rates;
+    for (const auto& item : split(rates_string, ',')) {
+        double rate = 0;
+        try {
+            rate = std::stod(item);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse target rate '" + item + "' of -qps option");
+        }
+        if (rate <= 0) {
+            throw std::logic_error("Target rates of -qps option should be positive, got " + item);
+        }
+        rates.push_back(rate);
+    }
+    if (rates.empty()) {
+        throw std::logic_error("-qps option should contain at least one target rate");
+    }
+    // the knee point is searched for in the ascending order of the rates
+    std::sort(rates.begin(), rates.end());
+    return rates;
+}
+
 std::vector<float> split_float(const std::string& s, char delim) {
     std::vector<float> result;
     std::stringstream ss(s);
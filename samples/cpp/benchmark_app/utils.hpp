@@ -76,6 +76,7 @@ void update_device_config_for_virtual_device(const std::string& value,
 std::string get_shapes_string(const benchmark_app::PartialShapes& shapes);
 size_t get_batch_size(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
+std::vector<double> parse_target_rates(const std::string& rates_string);
 std::map<std::string, std::vector<float>> parse_scale_or_mean(const std::string& scale_mean,
                                                               const benchmark_app::InputsInfo& inputs_info);
 std::pair<std::string, std::vector<std::string>> parse_input_files(const std::string& file_paths_string);
@@ -34,6 +34,11 @@ public:
     double avg = 0;
     double min = 0;
     double max = 0;
+    // tail latency percentiles
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p99_9 = 0;
     std::string data_shape;
 
 private:
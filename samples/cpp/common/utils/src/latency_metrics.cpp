@@ -39,4 +39,11 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
     median_or_percentile = latencies[size_t(latencies.size() / 100.0 * percentile_boundary)];
     max = latencies.back();
+    auto percentile = [&latencies](double boundary) {
+        return latencies[std::min(size_t(latencies.size() / 100.0 * boundary), latencies.size() - 1)];
+    };
+    p50 = percentile(50.0);
+    p90 = percentile(90.0);
+    p99 = percentile(99.0);
+    p99_9 = percentile(99.9);
 };
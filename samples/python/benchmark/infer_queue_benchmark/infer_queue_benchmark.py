@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright (C) 2018-2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import logging as log
+import sys
+from time import perf_counter
+
+import numpy as np
+import openvino as ov
+import openvino.opset13 as ops
+
+
+def small_model():
+    data = ops.parameter([1, 64], np.float32, name='data')
+    return ov.Model([ops.relu(data)], [data], 'small_model')
+
+
+def run(compiled_model, input_data, jobs, seconds_to_run, batched):
+    ireqs = ov.AsyncInferQueue(compiled_model, jobs)
+    finished = [0]
+    checksum = [0.0]
+
+    def callback(request, _):
+        finished[0] += 1
+        checksum[0] += float(request.results[0][0, 0])
+
+    def batch_callback(finished_jobs):
+        finished[0] += len(finished_jobs)
+        for results, _ in finished_jobs:
+            checksum[0] += float(results[0][0, 0])
+
+    if batched:
+        ireqs.set_batch_callback(batch_callback, share_outputs=True)
+    else:
+        ireqs.set_callback(callback)
+    # Warm up
+    for _ in range(len(ireqs)):
+        ireqs.start_async({0: input_data})
+    ireqs.wait_all()
+    finished[0] = 0
+
+    started = 0
+    start = perf_counter()
+    time_point_to_finish = start + seconds_to_run
+    while perf_counter() < time_point_to_finish:
+        ireqs.start_async({0: input_data})
+        started += 1
+    ireqs.wait_all()
+    duration = perf_counter() - start
+    if finished[0] != started:
+        raise RuntimeError(f'{started} requests are started, but {finished[0]} are finished')
+    return started / duration
+
+
+def main():
+    log.basicConfig(format='[ %(levelname)s ] %(message)s', level=log.INFO, stream=sys.stdout)
+    log.info('OpenVINO:')
+    log.info(f"{'Build ':.<39} {ov.__version__}")
+    if len(sys.argv) > 3:
+        log.info(f'Usage: {sys.argv[0]} <path_to_model>(default: small generated model) <device_name>(default: CPU)')
+        return 1
+    model = sys.argv[1] if len(sys.argv) > 1 else small_model()
+    device_name = sys.argv[2] if len(sys.argv) > 2 else 'CPU'
+
+    core = ov.Core()
+    compiled_model = core.compile_model(model, device_name, {'PERFORMANCE_HINT': 'THROUGHPUT'})
+    jobs = compiled_model.get_property('OPTIMAL_NUMBER_OF_INFER_REQUESTS')
+    model_input = compiled_model.input(0)
+    input_data = np.random.RandomState(0).uniform(size=list(model_input.shape)).astype(
+        model_input.element_type.to_dtype())
+
+    seconds_to_run = 5
+    # The per-request callbacks acquire the GIL for every finished job and copy the results,
+    # the batch callback acquires it once per batch of the finished jobs and gets views of the outputs
+    per_request = run(compiled_model, input_data, jobs, seconds_to_run, batched=False)
+    log.info(f'Infer requests: {jobs}')
+    log.info(f'Per-request callbacks: {per_request:.2f} requests/s')
+    # The releases without the batch callback measure only the per-request callbacks, which is the baseline
+    # to compare the per-request callbacks of the current release with
+    if not hasattr(ov.AsyncInferQueue, 'set_batch_callback'):
+        log.info('Batch callback:        not supported')
+        return 0
+    batched = run(compiled_model, input_data, jobs, seconds_to_run, batched=True)
+    log.info(f'Batch callback:        {batched:.2f} requests/s')
+    log.info(f'Speedup:               {batched / per_request:.2f}x')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
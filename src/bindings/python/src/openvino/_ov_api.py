@@ -5,7 +5,7 @@
 import io
 from types import TracebackType
 from typing import Any, Union, Optional
-from collections.abc import Iterator
+from collections.abc import Callable, Iterator
 from pathlib import Path
 import traceback  # noqa: F811
 
@@ -538,6 +538,41 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    def set_batch_callback(self, callback: Callable, share_outputs: bool = True) -> None:
+        """Sets callback receiving the finished jobs of the queue's pool in batches.
+
+        The jobs are delivered by the queue's own thread: all the jobs finished since
+        the previous delivery are passed to a single call of the callback, so the GIL
+        is acquired once per batch instead of once per job. The callback accepts one
+        argument, the list of tuples of the job's results and its userdata.
+        The InferRequests of the batch become idle once the callback returns.
+
+        .. code-block:: python
+
+            def f(jobs):
+                for results, userdata in jobs:
+                    print(results[0] + userdata)
+
+            async_infer_queue.set_batch_callback(f)
+
+        :param callback: Any Python defined function that matches callback's requirements.
+        :type callback: Callable[[list[tuple[OVDict, Any]]], None]
+        :param share_outputs: Enables `share_outputs` mode. Controls memory usage on inference's outputs.
+
+                              If set to `True` the results are numpy views of the output tensors
+                              of the InferRequests, they are valid only until the callback returns.
+                              The data which is used later has to be copied by the callback.
+
+                              If set to `False` the results are copied.
+
+                              Default value: True
+        :type share_outputs: bool, optional
+        """
+        def wrapper(jobs: list) -> None:
+            callback([(OVDict(results), userdata) for results, userdata in jobs])
+
+        super().set_batch_callback(wrapper, share_outputs)
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -106,6 +106,38 @@ class AsyncInferQueue(openvino._pyopenvino.AsyncInferQueue):
                                       Default value: False
                 :type share_inputs: bool, optional
                 
+        """
+    def set_batch_callback(self, callback: collections.abc.Callable, share_outputs: bool = True) -> None:
+        """
+        Sets callback receiving the finished jobs of the queue's pool in batches.
+        
+                The jobs are delivered by the queue's own thread: all the jobs finished since
+                the previous delivery are passed to a single call of the callback, so the GIL
+                is acquired once per batch instead of once per job. The callback accepts one
+                argument, the list of tuples of the job's results and its userdata.
+                The InferRequests of the batch become idle once the callback returns.
+        
+                .. code-block:: python
+        
+                    def f(jobs):
+                        for results, userdata in jobs:
+                            print(results[0] + userdata)
+        
+                    async_infer_queue.set_batch_callback(f)
+        
+                :param callback: Any Python defined function that matches callback's requirements.
+                :type callback: Callable[[list[tuple[OVDict, Any]]], None]
+                :param share_outputs: Enables `share_outputs` mode. Controls memory usage on inference's outputs.
+        
+                                      If set to `True` the results are numpy views of the output tensors
+                                      of the InferRequests, they are valid only until the callback returns.
+                                      The data which is used later has to be copied by the callback.
+        
+                                      If set to `False` the results are copied.
+        
+                                      Default value: True
+                :type share_outputs: bool, optional
+                
         """
 class CompiledModel(openvino._pyopenvino.CompiledModel):
     """
@@ -11,11 +11,13 @@ from openvino._pyopenvino.properties import enable_profiling
 from openvino._pyopenvino.properties import cache_dir
 from openvino._pyopenvino.properties import cache_mode
 from openvino._pyopenvino.properties import auto_batch_timeout
+from openvino._pyopenvino.properties import auto_batch_latency_slo
 from openvino._pyopenvino.properties import num_streams
 from openvino._pyopenvino.properties import inference_num_threads
 from openvino._pyopenvino.properties import compilation_num_threads
 from openvino._pyopenvino.properties import force_tbb_terminate
 from openvino._pyopenvino.properties import enable_mmap
+from openvino._pyopenvino.properties import enable_weights_deduplication
 from openvino._pyopenvino.properties import supported_properties
 from openvino._pyopenvino.properties import available_devices
 from openvino._pyopenvino.properties import model_name
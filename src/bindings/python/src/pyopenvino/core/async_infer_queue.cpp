@@ -6,11 +6,14 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -28,49 +31,88 @@ public:
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        m_idle_flags = std::vector<std::atomic<bool>>(jobs);
+        m_completion_nodes = std::vector<CompletionNode>(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
             // copy Inputs and Outputs from ov::CompiledModel
             m_requests.emplace_back(model.create_infer_request(), model.inputs(), model.outputs(), false);
             m_user_ids.push_back(py::none());
-            m_idle_handles.push(handle);
+            m_idle_flags[handle] = true;
+            m_completion_nodes[handle].handle = handle;
         }
+        m_idle_count = jobs;
 
         this->set_default_callbacks();
     }
 
     ~AsyncInferQueue() {
+        if (m_dispatcher.joinable()) {
+            // release GIL to let the dispatcher deliver the pending completions
+            ConditionalGILScopedRelease release;
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request->wait();
+                } catch (...) {
+                    // the errors of the inference are not reported on destruction
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_dispatcher_cv.notify_one();
+            m_dispatcher.join();
+        }
         m_requests.clear();
     }
 
     bool _is_ready() {
         // Check if any request has finished already
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return !(m_idle_handles.empty());
+        check_errors();
+        return m_idle_count.load() > 0;
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
+        size_t idle_handle = find_idle_handle();
+        if (idle_handle == m_requests.size()) {
+            // slow path: sleep until a request is released
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiters++;
+            m_cv.wait(lock, [this, &idle_handle] {
+                idle_handle = find_idle_handle();
+                return idle_handle != m_requests.size();
+            });
+            m_waiters--;
+        }
         // wait for request to make sure it returned from callback
         m_requests[idle_handle].m_request->wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        check_errors();
         return idle_handle;
     }
 
+    void start_async(size_t handle) {
+        // the handle is the one returned by get_idle_request_id, only the thread starting the jobs takes the handles
+        m_idle_flags[handle] = false;
+        m_idle_count--;
+        // Now GIL can be released - we are NOT working with Python objects in this block
+        ConditionalGILScopedRelease release;
+        *m_requests[handle].m_start_time = Time::now();
+        try {
+            // Start InferRequest in asynchronus mode
+            m_requests[handle].m_request->start_async();
+        } catch (...) {
+            // the callback is not called for the request which has not been started
+            release_handle(handle);
+            throw;
+        }
+    }
+
     void wait_all() {
         // Wait for all request to complete
         // release GIL to avoid deadlock on python callback
@@ -78,10 +120,16 @@ public:
         for (auto&& request : m_requests) {
             request.m_request->wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        if (m_idle_count.load() != m_requests.size()) {
+            // the batched completions of the finished requests may still be in delivery
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiters++;
+            m_cv.wait(lock, [this] {
+                return m_idle_count.load() == m_requests.size();
+            });
+            m_waiters--;
+        }
+        check_errors();
     }
 
     void set_default_callbacks() {
@@ -90,14 +138,8 @@ public:
 
             m_requests[handle].m_request->set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                // Add idle handle to the pool and notify locks in getIdleRequestId()
+                release_handle(handle);
 
                 try {
                     if (exception_ptr) {
@@ -128,20 +170,12 @@ public:
                         // performing PyErr_Fetch which clears error indicator and
                         // saves it inside itself.
                         assert(py_error.type());
-                        // acquire the mutex to access m_errors
-                        std::lock_guard<std::mutex> lock(m_mutex);
-                        m_errors.push(py_error);
+                        add_error(py_error);
                     }
                 }
 
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                // Add idle handle to the pool and notify locks in getIdleRequestId()
+                release_handle(handle);
 
                 try {
                     if (exception_ptr) {
@@ -154,14 +188,186 @@ public:
         }
     }
 
+    void set_batch_callback(py::function f_callback, bool share_outputs) {
+        // need to acquire GIL before py::function deletion
+        auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
+        {
+            // the dispatcher may be delivering the batch of the jobs in flight, it takes the callback under the mutex
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::swap(m_batch_callback, callback_sp);
+            m_share_outputs = share_outputs;
+            if (!m_dispatcher.joinable()) {
+                m_dispatcher = std::thread(&AsyncInferQueue::dispatch_completions, this);
+            }
+        }
+
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request->set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    // The handle is released by the dispatcher once the Python callback is done with the outputs
+                    push_completion(handle);
+                    return;
+                }
+
+                release_handle(handle);
+                try {
+                    std::rethrow_exception(exception_ptr);
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
+
+private:
+    // The node of the intrusive stack of the finished jobs, every handle has its own node as a job of the handle
+    // can't finish again before it is delivered
+    struct CompletionNode {
+        size_t handle = 0;
+        CompletionNode* next = nullptr;
+    };
+
+    size_t find_idle_handle() {
+        // Start from the last found handle, so the consecutive calls return the same handle until it is acquired
+        // and the handles are reused round-robin
+        const size_t jobs = m_requests.size();
+        const size_t first = m_next_handle.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < jobs; i++) {
+            const size_t handle = (first + i) % jobs;
+            // seq_cst pairs with release_handle: either the waiter sees the flag or the releaser sees the waiter
+            if (m_idle_flags[handle].load(std::memory_order_seq_cst)) {
+                m_next_handle.store(handle, std::memory_order_relaxed);
+                return handle;
+            }
+        }
+        return jobs;
+    }
+
+    void release_handle(size_t handle) {
+        m_idle_flags[handle].store(true, std::memory_order_seq_cst);
+        m_idle_count++;
+        // the waiters register themselves under the mutex before checking the flags, so either they see the flag or
+        // they are seen here, which requires the sequential consistency of the flags and of the waiters on both sides
+        if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+    void push_completion(size_t handle) {
+        auto* node = &m_completion_nodes[handle];
+        node->next = m_completions.load(std::memory_order_relaxed);
+        // seq_cst pairs with the dispatcher going to sleep: either it sees the node or the node's pusher sees it waiting
+        while (!m_completions.compare_exchange_weak(node->next, node, std::memory_order_seq_cst)) {
+        }
+        if (m_dispatcher_waiting.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_dispatcher_cv.notify_one();
+        }
+    }
+
+    void dispatch_completions() {
+        std::vector<size_t> handles;
+        handles.reserve(m_requests.size());
+        while (true) {
+            // the whole stack is taken at once, so the nodes are never popped concurrently with the pushes of them
+            auto* node = m_completions.exchange(nullptr, std::memory_order_acquire);
+            if (node == nullptr) {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_dispatcher_waiting = true;
+                m_dispatcher_cv.wait(lock, [this] {
+                    return m_completions.load() != nullptr || m_stop;
+                });
+                m_dispatcher_waiting = false;
+                if (m_completions.load() == nullptr) {
+                    return;
+                }
+                continue;
+            }
+
+            handles.clear();
+            for (; node != nullptr; node = node->next) {
+                handles.push_back(node->handle);
+            }
+            // restore the order of the completions
+            std::reverse(handles.begin(), handles.end());
+            deliver(handles);
+            for (auto handle : handles) {
+                release_handle(handle);
+            }
+        }
+    }
+
+    void deliver(const std::vector<size_t>& handles) {
+        std::shared_ptr<py::function> callback_sp;
+        bool share_outputs = true;
+        {
+            // the mutex is never held while waiting for the GIL, set_batch_callback takes it holding the GIL
+            std::lock_guard<std::mutex> lock(m_mutex);
+            callback_sp = m_batch_callback;
+            share_outputs = m_share_outputs;
+        }
+        // One GIL acquisition for the whole batch of the finished jobs
+        ConditionalGILScopedAcquire acquire;
+        try {
+            py::list jobs(handles.size());
+            for (size_t i = 0; i < handles.size(); i++) {
+                // the shared outputs are valid until the handle is released, i.e. till the callback returns
+                auto results = Common::outputs_to_dict(m_requests[handles[i]], share_outputs, true);
+                jobs[i] = py::make_tuple(std::move(results), m_user_ids[handles[i]]);
+            }
+            (*callback_sp)(jobs);
+        } catch (const py::error_already_set& py_error) {
+            assert(py_error.type());
+            add_error(py_error);
+        } catch (const std::exception& e) {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            add_error(py::error_already_set());
+        }
+    }
+
+    void add_error(const py::error_already_set& error) {
+        // acquire the mutex to access m_errors
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_errors.push(error);
+        m_has_errors = true;
+    }
+
+    void check_errors() {
+        if (m_has_errors.load()) {
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            throw m_errors.front();
+        }
+    }
+
+    // The idle handles are tracked with the flags, the mutex is taken only to sleep while there are no idle requests
+    std::vector<std::atomic<bool>> m_idle_flags;
+    std::atomic<size_t> m_idle_count{0};
+    std::atomic<size_t> m_next_handle{0};
+    std::atomic<size_t> m_waiters{0};
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    std::atomic<bool> m_has_errors{false};
     std::queue<py::error_already_set> m_errors;
+
+    // Batched completions: the finished jobs are pushed to the lock-free stack by the requests' callbacks and
+    // delivered to Python by the dispatcher thread
+    std::vector<CompletionNode> m_completion_nodes;
+    std::atomic<CompletionNode*> m_completions{nullptr};
+    // guarded by the mutex, the callback may be replaced while the dispatcher delivers a batch
+    std::shared_ptr<py::function> m_batch_callback;
+    bool m_share_outputs = true;
+    std::thread m_dispatcher;
+    std::condition_variable m_dispatcher_cv;
+    std::atomic<bool> m_dispatcher_waiting{false};
+    bool m_stop = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -190,21 +396,11 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
             self.m_requests[handle].m_request->set_input_tensor(inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                ConditionalGILScopedRelease release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request->start_async();
-            }
+            self.start_async(handle);
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -236,21 +432,11 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
             Common::set_request_tensors(*self.m_requests[handle].m_request, inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                ConditionalGILScopedRelease release;
-                *self.m_requests[handle].m_start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request->start_async();
-            }
+            self.start_async(handle);
         },
         py::arg("inputs"),
         py::arg("userdata"),
@@ -321,6 +507,35 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batch_callback",
+            &AsyncInferQueue::set_batch_callback,
+            py::arg("callback"),
+            py::arg("share_outputs") = true,
+            R"(
+            Sets callback receiving the finished jobs of the queue's pool in batches.
+
+            The jobs are delivered by the queue's own thread: all the jobs finished since
+            the previous delivery are passed to a single call of the callback, so the GIL
+            is acquired once per batch instead of once per job. The callback accepts one
+            argument, the list of tuples of the job's results and its userdata.
+            The InferRequests of the batch become idle once the callback returns.
+
+            .. code-block:: python
+
+                def f(jobs):
+                    for results, userdata in jobs:
+                        print(results[0] + userdata)
+
+                async_infer_queue.set_batch_callback(f)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param share_outputs: If set to `True`, the results are numpy views of the output
+                                  tensors, which are valid only until the callback returns.
+                                  Otherwise the results are copied. Default: True
+            :type share_outputs: bool
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
@@ -32,11 +32,13 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::workload_type, "workload_type");
     wrap_property_RW(m_properties, ov::cache_mode, "cache_mode");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_latency_slo, "auto_batch_latency_slo");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
     wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
+    wrap_property_RW(m_properties, ov::enable_weights_deduplication, "enable_weights_deduplication");
     wrap_property_RW(m_properties, ov::weights_path, "weights_path");
     wrap_property_RW(m_properties, ov::key_cache_precision, "key_cache_precision");
     wrap_property_RW(m_properties, ov::value_cache_precision, "value_cache_precision");
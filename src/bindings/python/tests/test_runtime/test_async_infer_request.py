@@ -221,6 +221,55 @@ def test_results_async_infer(device, share_inputs):
             infer_queue[i].results.values()))
 
 
+@pytest.mark.parametrize("share_outputs", [True, False])
+@pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
+def test_infer_queue_batch_callback(device, share_outputs):
+    jobs = 16
+    num_request = 4
+    core = Core()
+    param = ops.parameter([10], dtype=np.float32, name="data")
+    model = Model(ops.abs(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = {}
+
+    def callback(finished_jobs):
+        assert len(finished_jobs) > 0
+        for results, job_id in finished_jobs:
+            jobs_done[job_id] = np.array(results[0], copy=True)
+
+    infer_queue.set_batch_callback(callback, share_outputs=share_outputs)
+    for i in range(jobs):
+        infer_queue.start_async({"data": np.full([10], -i, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+
+    assert infer_queue.is_ready()
+    assert sorted(jobs_done.keys()) == list(range(jobs))
+    for job_id, result in jobs_done.items():
+        assert np.array_equal(result, np.full([10], job_id, dtype=np.float32))
+
+
+@pytest.mark.skipif(sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Ticket: 171534")
+def test_infer_queue_batch_callback_fail(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(finished_jobs):
+        raise ValueError("Batch callback failed")
+
+    img = generate_image()
+    infer_queue.set_batch_callback(callback)
+
+    with pytest.raises(ValueError) as e:
+        for _ in range(4):
+            infer_queue.start_async({"data": img})
+        infer_queue.wait_all()
+
+    assert "Batch callback failed" in str(e.value)
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_array_like_input_async_infer_queue(device, share_inputs):
     class ArrayLikeObject:
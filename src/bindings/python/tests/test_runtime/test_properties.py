@@ -243,6 +243,14 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (
+            props.auto_batch_latency_slo,
+            "AUTO_BATCH_LATENCY_SLO",
+            (
+                (50, 50),
+                (np.uint32(20), 20),
+            ),
+        ),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -258,6 +266,7 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (props.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (props.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (props.enable_weights_deduplication, "ENABLE_WEIGHTS_DEDUPLICATION", ((True, True), (False, False))),
         (
             props.weights_path,
             "WEIGHTS_PATH",
@@ -89,8 +89,16 @@ public:
     // Note: override when final is redundant, but needed to avoid warnings on some compilers
     void update_by_expression(const lowered::ExpressionPtr& expr,
                               const lowered::LinearIRCPtr& linear_ir) override final {
+        const auto prev_hash = m_kernel ? m_config.hash() : 0;
         update_config(expr, linear_ir, m_config);
         OPENVINO_ASSERT(m_config.is_completed(), "Failed to update kernel config in update_by_expression");
+        // The shapes might be changed in the dimensions which the kernel doesn't depend on (e.g. the work amount of
+        // the outer loop), so the current kernel is still valid and the kernel update is not needed.
+        // Note: only the kernel update is skipped, the config is recomputed from the expression on each update, since
+        // the LinearIR doesn't track which of the shape dimensions the config depends on
+        if (m_kernel && m_config.hash() == prev_hash) {
+            return;
+        }
         update_kernel(m_config, m_kernel);
         OPENVINO_ASSERT(m_kernel, "Failed to compile kernel executor");
     }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include "snippets/lowered/expression.hpp"
 #include "snippets/lowered/linear_ir.hpp"
@@ -57,6 +58,17 @@ public:
     LinearIR::container clone_range(LinearIR::container::const_iterator begin,
                                     LinearIR::container::const_iterator end,
                                     ExpressionMap& expression_map) const;
+    /**
+     * @brief Make a full copy of LinearIR and of the LinearIR sharing the tensor shapes with it (e.g. the shape
+     *        inference LinearIR of the lowered Subgraph). The copies share the tensor shapes in the same way, but not
+     *        with the originals. The rules described in `m_config` are not applied.
+     * @param linear_ir Linear IR
+     * @param shape_sharing_linear_ir Linear IR which shares (some of) the tensor shapes with `linear_ir`
+     * @return the pair of clones of `linear_ir` and `shape_sharing_linear_ir`
+     */
+    static std::pair<std::shared_ptr<LinearIR>, std::shared_ptr<LinearIR>> clone_with_shared_shapes(
+        const std::shared_ptr<LinearIR>& linear_ir,
+        const std::shared_ptr<LinearIR>& shape_sharing_linear_ir);
 
 private:
     void clone(const LinearIR* src, LinearIR* dst, ExpressionMap& expression_map) const;
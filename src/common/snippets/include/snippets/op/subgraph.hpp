@@ -157,6 +157,27 @@ public:
     const std::shared_ptr<RuntimeConfigurator>& get_runtime_configurator() const;
     const std::shared_ptr<RuntimeConfig>& update_runtime_config() const;
 
+    /**
+     * @interface LoweredState
+     * @brief The LinearIRs of the Subgraph after the control flow transformations. The state of a Subgraph may be set
+     *        to the structurally identical Subgraphs transformed with the same parameters, so their transformations
+     *        are not repeated.
+     */
+    struct LoweredState {
+        std::shared_ptr<lowered::LinearIR> linear_ir = nullptr;
+        std::shared_ptr<lowered::LinearIR> shape_infer_linear_ir = nullptr;
+    };
+    /**
+     * @brief Returns the copy of the lowered state, which is not changed by the further reshapes of the Subgraph
+     */
+    LoweredState get_lowered_state() const;
+    /**
+     * @brief Sets the copy of the lowered state instead of the data flow and control flow transformations.
+     *        The body is not transformed, so only the lowered pipeline (the shape inference, the runtime configuration
+     *        and the code generation) may be used after it.
+     */
+    void set_lowered_state(const LoweredState& state);
+
     static auto wrap_node_as_subgraph(const std::shared_ptr<ov::Node>& node) -> std::shared_ptr<Subgraph>;
     static void fill_empty_output_names(const Output<Node>& target_output_node,
                                         const Output<Node>& replacement_output_node);
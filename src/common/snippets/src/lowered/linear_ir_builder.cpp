@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -18,6 +19,8 @@
 #include "snippets/lowered/expression.hpp"
 #include "snippets/lowered/linear_ir.hpp"
 #include "snippets/lowered/loop_manager.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+#include "snippets/shape_types.hpp"
 
 namespace ov::snippets::lowered {
 
@@ -95,6 +98,39 @@ void LinearIRBuilder::clone(const LinearIR* src, LinearIR* dst, ExpressionMap& e
     dst->m_is_dynamic = src->m_is_dynamic;
 }
 
+std::pair<std::shared_ptr<LinearIR>, std::shared_ptr<LinearIR>> LinearIRBuilder::clone_with_shared_shapes(
+    const std::shared_ptr<LinearIR>& linear_ir,
+    const std::shared_ptr<LinearIR>& shape_sharing_linear_ir) {
+    OPENVINO_ASSERT(linear_ir && shape_sharing_linear_ir,
+                    "Invalid pointers were provided for LinearIRBuilder::clone_with_shared_shapes");
+    // The shallow copies share the tensor shapes with the originals:
+    // each original shape is replaced with its single copy in both LinearIRs
+    const LinearIRBuilder shallow_builder(Config(false));
+    auto result = std::make_pair(shallow_builder.clone(linear_ir), shallow_builder.clone(shape_sharing_linear_ir));
+    std::unordered_map<const VectorDims*, VectorDimsPtr> shape_copies;
+    auto copy_shape = [&shape_copies](const PortDescriptorPtr& desc) {
+        if (!desc->m_tensor_shape) {
+            return;
+        }
+        auto& shape_copy = shape_copies[desc->m_tensor_shape.get()];
+        if (!shape_copy) {
+            shape_copy = std::make_shared<VectorDims>(*desc->m_tensor_shape);
+        }
+        desc->m_tensor_shape = shape_copy;
+    };
+    for (const auto& copy : {result.first, result.second}) {
+        for (const auto& expr : *copy) {
+            for (size_t i = 0; i < expr->get_input_count(); ++i) {
+                copy_shape(expr->get_input_port_descriptor(i));
+            }
+            for (size_t i = 0; i < expr->get_output_count(); ++i) {
+                copy_shape(expr->get_output_port_descriptor(i));
+            }
+        }
+    }
+    return result;
+}
+
 LinearIR::container LinearIRBuilder::clone_range(LinearIR::container::const_iterator begin,
                                                  LinearIR::container::const_iterator end,
                                                  ExpressionMap& expression_map) const {
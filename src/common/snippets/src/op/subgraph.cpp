@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <ostream>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -636,6 +637,22 @@ const std::shared_ptr<RuntimeConfig>& Subgraph::update_runtime_config() const {
     return get_runtime_configurator()->get_updated_config(m_linear_ir);
 }
 
+Subgraph::LoweredState Subgraph::get_lowered_state() const {
+    OPENVINO_ASSERT(m_linear_ir && m_shape_infer_linear_ir, "Attempt to get the lowered state of not lowered Subgraph");
+    auto linear_irs = lowered::LinearIRBuilder::clone_with_shared_shapes(m_linear_ir, m_shape_infer_linear_ir);
+    return {std::move(linear_irs.first), std::move(linear_irs.second)};
+}
+
+void Subgraph::set_lowered_state(const LoweredState& state) {
+    OPENVINO_ASSERT(state.linear_ir && state.shape_infer_linear_ir, "Attempt to set an empty lowered state");
+    // Note: the LinearIR for ShapeInfer must share the tensor shapes with the main LinearIR as after
+    // control_flow_transformations, so the shapes are propagated to the main LinearIR by the shape inference
+    std::tie(m_linear_ir, m_shape_infer_linear_ir) =
+        lowered::LinearIRBuilder::clone_with_shared_shapes(state.linear_ir, state.shape_infer_linear_ir);
+    m_shape_infer = m_shape_infer_linear_ir->get_shape_infer_instance();
+    OPENVINO_ASSERT(m_shape_infer, "ShapeInference based on ShapeInferenceLinearIR has not been successfully created!");
+}
+
 void Subgraph::print() const {
     INTERNAL_OP_SCOPE(Subgraph);
     remark(13) << "subgraph " << this->get_friendly_name() << " " << this->get_type_name() << " which contains "
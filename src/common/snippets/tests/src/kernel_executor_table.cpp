@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/kernel_executor_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace test {
+namespace snippets {
+namespace {
+
+class CountingKernelConfig : public ov::snippets::KernelExecutorBase::GenericConfig {
+public:
+    bool is_completed() const override {
+        return true;
+    }
+    std::unique_ptr<GenericConfig> get_clone_ptr() const override {
+        return std::make_unique<CountingKernelConfig>(*this);
+    }
+    size_t hash() const override {
+        return work_amount;
+    }
+#ifdef SNIPPETS_DEBUG_CAPS
+    std::string to_string() const override {
+        return std::to_string(work_amount);
+    }
+#endif
+
+    size_t work_amount = 0;
+};
+
+struct CountingKernel {};
+
+// The config is taken from the external work amount instead of the expression
+class CountingKernelExecutor : public ov::snippets::KernelExecutor<CountingKernelConfig, CountingKernel> {
+public:
+    CountingKernelExecutor(const size_t& work_amount, size_t& compilations)
+        : KernelExecutor(CountingKernelConfig()),
+          m_work_amount(work_amount),
+          m_compilations(compilations) {}
+
+protected:
+    void update_config([[maybe_unused]] const ov::snippets::lowered::ExpressionPtr& expr,
+                       [[maybe_unused]] const ov::snippets::lowered::LinearIRCPtr& linear_ir,
+                       CountingKernelConfig& config) const override {
+        config.work_amount = m_work_amount;
+    }
+    void update_kernel([[maybe_unused]] const CountingKernelConfig& c,
+                       std::shared_ptr<CountingKernel>& kernel) const override {
+        kernel = std::make_shared<CountingKernel>();
+        ++m_compilations;
+    }
+
+private:
+    const size_t& m_work_amount;
+    size_t& m_compilations;
+};
+
+}  // namespace
+
+TEST(KernelExecutorTest, KernelIsUpdatedOnlyOnConfigChange) {
+    size_t work_amount = 16;
+    size_t compilations = 0;
+    CountingKernelExecutor executor(work_amount, compilations);
+
+    executor.update_by_expression(nullptr, nullptr);
+    ASSERT_EQ(compilations, 1U);
+    const auto kernel = executor.get_kernel();
+
+    executor.update_by_expression(nullptr, nullptr);
+    ASSERT_EQ(compilations, 1U);
+    ASSERT_EQ(executor.get_kernel(), kernel);
+
+    work_amount = 17;
+    executor.update_by_expression(nullptr, nullptr);
+    ASSERT_EQ(compilations, 2U);
+    ASSERT_NE(executor.get_kernel(), kernel);
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
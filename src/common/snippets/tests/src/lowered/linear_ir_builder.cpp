@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/opsets/opset10.hpp"
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/linear_ir_builder.hpp"
+#include "snippets/shape_inference/shape_inference.hpp"
+
+using namespace ov::snippets::lowered;
+
+TEST(Snippets_LinearIRBuilder, CloneWithSharedShapes) {
+    Config lir_config;
+    lir_config.m_manual_build_support = true;
+    const auto linear_ir =
+        std::make_shared<LinearIR>(lir_config, std::make_shared<ov::snippets::IShapeInferSnippetsFactory>());
+    const auto param0 = linear_ir->push_node<ov::opset10::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    const auto param1 = linear_ir->push_node<ov::opset10::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    const auto add = linear_ir->push_node<ov::opset10::Add>(param0.second, param1.second);
+    linear_ir->push_node<ov::opset10::Result>(add.second);
+    // the same way as the LinearIR for ShapeInfer of the lowered Subgraph
+    const auto shape_infer_linear_ir = LinearIRBuilder(LinearIRBuilder::Config(false)).clone(linear_ir);
+
+    const auto copies = LinearIRBuilder::clone_with_shared_shapes(linear_ir, shape_infer_linear_ir);
+    ASSERT_EQ(copies.first->get_ops().size(), linear_ir->get_ops().size());
+    ASSERT_EQ(copies.second->get_ops().size(), shape_infer_linear_ir->get_ops().size());
+
+    auto first_it = copies.first->begin();
+    auto second_it = copies.second->begin();
+    for (auto it = linear_ir->begin(); it != linear_ir->end(); ++it, ++first_it, ++second_it) {
+        for (size_t i = 0; i < (*it)->get_output_count(); ++i) {
+            const auto& original_shape = (*it)->get_output_port_descriptor(i)->get_shape();
+            const auto& first_shape = (*first_it)->get_output_port_descriptor(i)->get_shape();
+            const auto& second_shape = (*second_it)->get_output_port_descriptor(i)->get_shape();
+            EXPECT_EQ(first_shape, original_shape);
+            // the copies share the shapes with each other, but not with the originals
+            EXPECT_EQ(&first_shape, &second_shape);
+            EXPECT_NE(&first_shape, &original_shape);
+        }
+    }
+}
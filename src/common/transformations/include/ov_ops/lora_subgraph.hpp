@@ -19,6 +19,9 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): the index of the adapter of each batch item. If present, `LoRA_matrices` are the pools
+ *    of the stacked matrices of several adapters, and the body gathers the matrices of each batch item by its index,
+ *    so the batch items with different adapters are processed together.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -18,8 +18,15 @@ class TRANSFORMATIONS_API LoraSubgraphFusion;
 }  // namespace pass
 }  // namespace ov
 
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief LoraSubgraphFusion fuses the LoRA pattern into LoraSubgraph op.
+ * @param fuse_adapter_pools enables the fusion of the LoRA matrices gathered from the adapter pools by the adapter index
+ * of each batch item, the LoraSubgraph takes the indices as an additional 6th input in this case. Must be enabled only
+ * by the plugins supporting such LoraSubgraph.
+ */
 class ov::pass::LoraSubgraphFusion : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
-    LoraSubgraphFusion();
+    explicit LoraSubgraphFusion(bool fuse_adapter_pools = false);
 };
@@ -9,36 +9,50 @@
 
 #include "itt.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/pass/pattern/op/optional.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "transformations/utils/utils.hpp"
 
-ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
+ov::pass::LoraSubgraphFusion::LoraSubgraphFusion(bool fuse_adapter_pools) {
     MATCHER_SCOPE(LoraSubgraphFusion);
     using namespace pass::pattern;
     auto lora_input_m = any_input();
     auto transpose_const1_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose1_m = optional<ov::op::v1::Transpose>({lora_input_m, transpose_const1_m}, consumers_count(1));
 
-    auto read_value1_m = wrap_type<ov::op::util::ReadValueBase>();
+    // The LoRA matrices are either the states of the request or the slices of the adapter pools (the stacked matrices
+    // of several adapters, in the states or in the constants) gathered by the adapter index of each batch item
+    auto read_value1_m = wrap_type<ov::op::util::ReadValueBase, ov::op::v0::Constant>();
     auto convert1_m = optional<ov::op::v0::Convert>(read_value1_m, consumers_count(1));
-    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, convert1_m}, consumers_count(1));
+    auto gather1_m = optional<ov::op::util::GatherBase>({convert1_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, gather1_m}, consumers_count(1));
 
-    auto read_value2_m = wrap_type<ov::op::util::ReadValueBase>();
+    auto read_value2_m = wrap_type<ov::op::util::ReadValueBase, ov::op::v0::Constant>();
     auto convert2_m = optional<ov::op::v0::Convert>(read_value2_m, consumers_count(1));
-    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, convert2_m}, consumers_count(1));
+    auto gather2_m = optional<ov::op::util::GatherBase>({convert2_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto reshape2_m =
+        optional<ov::op::v1::Reshape, ov::op::v0::Unsqueeze>({gather2_m, any_input()}, consumers_count(1));
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, reshape2_m}, consumers_count(1));
 
-    auto read_value3_m = wrap_type<ov::op::util::ReadValueBase>();
+    auto read_value3_m = wrap_type<ov::op::util::ReadValueBase, ov::op::v0::Constant>();
     auto convert3_m = optional<ov::op::v0::Convert>(read_value3_m, consumers_count(1));
-    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, convert3_m}, consumers_count(1));
+    auto gather3_m = optional<ov::op::util::GatherBase>({convert3_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, gather3_m}, consumers_count(1));
 
     auto transpose_const2_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose2_m = optional<ov::op::v1::Transpose>({matmul2_m, transpose_const2_m}, consumers_count(1));
@@ -65,6 +79,39 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        const std::vector<std::shared_ptr<ov::op::util::GatherBase>> gathers{
+            pattern_map.count(gather1_m)
+                ? ov::as_type_ptr<ov::op::util::GatherBase>(pattern_map.at(gather1_m).get_node_shared_ptr())
+                : nullptr,
+            pattern_map.count(gather2_m)
+                ? ov::as_type_ptr<ov::op::util::GatherBase>(pattern_map.at(gather2_m).get_node_shared_ptr())
+                : nullptr,
+            pattern_map.count(gather3_m)
+                ? ov::as_type_ptr<ov::op::util::GatherBase>(pattern_map.at(gather3_m).get_node_shared_ptr())
+                : nullptr,
+        };
+        const bool is_pooled = gathers[0] != nullptr;
+        if (is_pooled && !fuse_adapter_pools)
+            return false;
+        for (const auto& gather : gathers) {
+            // all the matrices must be taken from the pools of the same adapter, or all must be the plain states
+            if ((gather != nullptr) != is_pooled)
+                return false;
+            if (gather && (gather->get_axis() != 0 || gather->get_batch_dims() != 0 ||
+                           gather->input_value(1) != gathers[0]->input_value(1)))
+                return false;
+        }
+        // the adapter pools may be constant, the matrices of a single adapter still have to be the states
+        const std::vector<std::shared_ptr<ov::Node>> pools{pattern_map.at(read_value1_m).get_node_shared_ptr(),
+                                                           pattern_map.at(read_value2_m).get_node_shared_ptr(),
+                                                           pattern_map.at(read_value3_m).get_node_shared_ptr()};
+        for (const auto& pool : pools) {
+            if (!is_pooled && ov::is_type<ov::op::v0::Constant>(pool))
+                return false;
+        }
+        if (!is_pooled && pattern_map.count(reshape2_m))
+            return false;
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -80,11 +127,11 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
+            is_pooled ? gathers[0]->input(0) : matmul1.get_node()->input(1),
+            is_pooled ? gathers[1]->input(0) : find_connected_input(multiply.get_node(), state_2.get_node()),
+            is_pooled ? gathers[2]->input(0) : matmul2.get_node()->input(1),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
@@ -99,6 +146,16 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (is_pooled) {
+            // the adapter indices are the last input, shared by all the gathers
+            const auto indices = gathers[0]->input_value(1);
+            auto indices_parameter =
+                std::make_shared<ov::op::v0::Parameter>(indices.get_element_type(), indices.get_partial_shape());
+            for (const auto& gather : gathers)
+                gather->input(1).replace_source_output(indices_parameter);
+            subgraph_parameters.push_back(indices_parameter);
+            external_connections.push_back(indices);
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
@@ -12,9 +12,11 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -74,6 +76,19 @@ std::shared_ptr<ov::Node> create_lora_subgraph(const ov::Output<ov::Node>& main_
     return std::make_shared<ov::op::v1::Add>(add_in_0, add_in_1);
 }
 
+// Takes the matrices of the adapter of each batch item from the adapter pools: [pools, rank, K], [pools, rank] and
+// [pools, N, rank], the alpha is unsqueezed to [batch, 1, rank]
+ov::OutputVector gather_states(const ov::OutputVector& pools, const ov::Output<ov::Node>& indices) {
+    OPENVINO_ASSERT(pools.size() == 3, "gather_states expects pools size == 3");
+    auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+    ov::OutputVector states;
+    for (const auto& pool : pools)
+        states.push_back(std::make_shared<ov::op::v8::Gather>(pool, indices, axis));
+    auto unsqueeze_axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+    states[1] = std::make_shared<ov::op::v0::Unsqueeze>(states[1], unsqueeze_axis);
+    return states;
+}
+
 class LoraSubgraphFusionTests : public TransformationTestsF {
 public:
     LoraSubgraphFusionTests() : TransformationTestsF() {
@@ -85,8 +100,11 @@ public:
 
     void SetUp() override {
         TransformationTestsF::SetUp();
-        manager.register_pass<ov::pass::LoraSubgraphFusion>();
+        manager.register_pass<ov::pass::LoraSubgraphFusion>(fuse_adapter_pools);
     }
+
+protected:
+    bool fuse_adapter_pools = false;
 };
 
 class LoraSubgraphFusionMatMulTests : public LoraSubgraphFusionTests {
@@ -225,6 +243,109 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+class LoraSubgraphFusionAdapterPoolsTests : public LoraSubgraphFusionMatMulTests {
+public:
+    LoraSubgraphFusionAdapterPoolsTests() : LoraSubgraphFusionMatMulTests() {
+        fuse_adapter_pools = true;
+    }
+};
+
+TEST_F(LoraSubgraphFusionMatMulTests, AdapterPoolsAreNotFusedByDefault) {
+    ov::PartialShape shape_pool_1 = {-1, -1, K};
+    ov::PartialShape shape_pool_2 = {-1, -1};
+    ov::PartialShape shape_pool_3 = {-1, N, -1};
+    auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+    auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+    auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+    auto lora_subgraph =
+        create_lora_subgraph(main_mm, param_lora, gather_states(pools.first, param_indices), false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    pools.second,
+                                    ParameterVector{param_lora, param_w, param_indices});
+}
+
+TEST_F(LoraSubgraphFusionAdapterPoolsTests, AdapterPools) {
+    ov::PartialShape shape_pool_1 = {-1, -1, K};
+    ov::PartialShape shape_pool_2 = {-1, -1};
+    ov::PartialShape shape_pool_3 = {-1, N, -1};
+    ov::PartialShape shape_indices = {-1};
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+        auto lora_subgraph =
+            create_lora_subgraph(main_mm, param_lora, gather_states(pools.first, param_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        pools.second,
+                                        ParameterVector{param_lora, param_w, param_indices});
+    }
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto inner_pool_1 = std::make_shared<ov::op::v0::Parameter>(netType, shape_pool_1);
+        auto inner_pool_2 = std::make_shared<ov::op::v0::Parameter>(netType, shape_pool_2);
+        auto inner_pool_3 = std::make_shared<ov::op::v0::Parameter>(netType, shape_pool_3);
+        auto inner_param_mm = std::make_shared<ov::op::v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+
+        ov::OutputVector pools_outs{inner_pool_1, inner_pool_2, inner_pool_3};
+        auto lora_subgraph =
+            create_lora_subgraph(inner_param_mm, inner_param_lora, gather_states(pools_outs, inner_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_pool_1,
+                                         inner_pool_2,
+                                         inner_pool_3,
+                                         inner_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+        ov::OutputVector lora_inputs{main_mm,
+                                     param_lora,
+                                     pools.first[0],
+                                     pools.first[1],
+                                     pools.first[2],
+                                     param_indices};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            pools.second,
+                                            ParameterVector{param_lora, param_w, param_indices});
+    }
+}
+
+TEST_F(LoraSubgraphFusionAdapterPoolsTests, AdapterPoolsWithDifferentIndices) {
+    ov::PartialShape shape_pool_1 = {-1, -1, K};
+    ov::PartialShape shape_pool_2 = {-1, -1};
+    ov::PartialShape shape_pool_3 = {-1, N, -1};
+    auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+    auto param_indices_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto param_indices_2 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+    auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+    auto states = gather_states(pools.first, param_indices_1);
+    // the up projection matrix of the other adapter: the pattern is not LoRA of the single adapter per batch item
+    states[2] = gather_states(pools.first, param_indices_2)[2];
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, states, false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    pools.second,
+                                    ParameterVector{param_lora, param_w, param_indices_1, param_indices_2});
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
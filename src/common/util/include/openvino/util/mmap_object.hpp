@@ -50,4 +50,14 @@ std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
 std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Hints the OS that the memory range is going to be accessed soon.
+ * The pages of the mapped file within the range are read ahead asynchronously, so the first access to them does not
+ * wait for the disk. The hint is ignored if the OS does not support it.
+ *
+ * @param data Pointer to the beginning of the range, it does not have to be page aligned.
+ * @param size Size of the range in bytes.
+ */
+void prefetch_memory(const void* data, size_t size) noexcept;
 }  // namespace ov
@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -107,4 +108,15 @@ std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path) {
     return holder;
 }
 
+void prefetch_memory(const void* data, size_t size) noexcept {
+    if (!data || size == 0) {
+        return;
+    }
+    static const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(data) & ~(page_size - 1);
+    const auto end = reinterpret_cast<uintptr_t>(data) + size;
+    // the hint is optional, so the failure is ignored
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+}
+
 }  // namespace ov
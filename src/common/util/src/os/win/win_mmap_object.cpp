@@ -143,4 +143,18 @@ std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path) {
 }
 #endif
 
+void prefetch_memory(const void* data, size_t size) noexcept {
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602  // PrefetchVirtualMemory is available since Windows 8
+    if (!data || size == 0) {
+        return;
+    }
+    WIN32_MEMORY_RANGE_ENTRY range{const_cast<void*>(data), size};
+    // the hint is optional, so the failure is ignored
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    (void)data;
+    (void)size;
+#endif
+}
+
 }  // namespace ov
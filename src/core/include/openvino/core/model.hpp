@@ -36,6 +36,10 @@ namespace frontend {
 class FrontEnd;
 }
 
+namespace pass {
+class Manager;
+}
+
 class ModelAccessor;
 
 /**
@@ -418,6 +422,14 @@ public:
 
 private:
     friend class ov::ModelAccessor;
+    friend class ov::pass::Manager;
+
+    // Revalidates the nodes changed since the previous validation of the model and the nodes which depend on them.
+    // Falls back to validate_nodes_and_infer_types() if the changes were not tracked.
+    void validate_changed_nodes_and_infer_types() const;
+
+    // Validates the nodes with validate_node and checks the parameters, variables and layouts of the results
+    void validate_nodes_and_infer_types(const std::function<void(const std::shared_ptr<Node>&)>& validate_node) const;
 
     // Allow to get attribute for the vector
     ov::Any& get_rt_info(ov::AnyMap& info,
@@ -129,6 +129,9 @@ class OPENVINO_API Node : public std::enable_shared_from_this<Node> {
 
     friend class Model;
 
+    // For access to m_shared_rt_info.
+    friend class SharedRTInfo;
+
 protected:
     friend OPENVINO_API bool ov::op::util::input_sources_are_equal(const std::shared_ptr<ov::Node>&,
                                                                    const std::shared_ptr<ov::Node>&,
@@ -465,7 +468,8 @@ private:
     // can be executed into multiple threads means that m_shared_rt_info
     // can be updated simultaneously, so we have to guaranty exclusive
     // update of this field by having specific method with mutex.
-    void insert_info(std::shared_ptr<SharedRTInfo> info);
+    // Returns false if the info has been already inserted.
+    bool insert_info(std::shared_ptr<SharedRTInfo> info);
     std::mutex m_insert_mutex;
 };
 
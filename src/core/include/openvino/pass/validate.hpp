@@ -21,6 +21,12 @@ namespace pass {
 /// pass does not break the shape and data type requirement on a computation node.
 /// This default validation run can be changed via calling the
 /// \link ov::pass::Manager::set_per_pass_validation(bool) \endlink function.
+///
+/// OV_VALIDATE_CHANGED_NODES environment variable set to "on" enables the experimental validation
+/// of the changed nodes: if the model was changed by GraphRewrites (MatcherPasses) only since the
+/// previous validation in the same \ref ov::pass::Manager run, only the changed nodes and the nodes
+/// which outputs depend on them are revalidated. The changes made in place outside the matched nodes
+/// are not tracked, so "check" compares the result with the full validation of the model.
 /// \ingroup ov_pass_cpp_api
 class OPENVINO_API Validate : public ModelPass {
 public:
@@ -40,10 +40,12 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
 
     // Output replacement may change the topological order of nodes,
     // so we have to reset cache by setting a flag into shared node info.
+    // The node has to be revalidated as its input has been changed.
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
+             [this](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
+                 info->mark_changed(m_node);
              });
 }
 
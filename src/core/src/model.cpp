@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "evaluator.hpp"
 #include "itt.hpp"
@@ -21,6 +22,8 @@
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
 #include "shared_node_info.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
@@ -125,6 +128,76 @@ std::map<ov::Output<ov::Node>, ov::PartialShape> tensor_names_shapes_to_node_sha
     return const_pshape;
 }
 
+using OutputTypes = std::vector<std::pair<ov::element::Type, ov::PartialShape>>;
+
+OutputTypes get_output_types(const ov::Node& node) {
+    OutputTypes types;
+    types.reserve(node.get_output_size());
+    for (const auto& output : node.outputs()) {
+        types.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+    return types;
+}
+
+std::vector<std::shared_ptr<ov::Symbol>> get_output_symbols(const ov::Node& node) {
+    std::vector<std::shared_ptr<ov::Symbol>> symbols;
+    for (const auto& output : node.outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.rank().is_static()) {
+            for (const auto& dim : shape) {
+                symbols.push_back(dim.get_symbol());
+            }
+        }
+    }
+    return symbols;
+}
+
+// The values of the outputs may be used by the shape inference of the consumers: the bounds of the output were
+// computed by the previous validation or it is integral as the outputs of the shape subgraphs
+bool may_have_used_values(const ov::Node& node) {
+    for (const auto& output : node.outputs()) {
+        const auto& tensor = output.get_tensor();
+        if (!output.get_element_type().is_real() || tensor.get_lower_value() || tensor.get_upper_value() ||
+            !tensor.get_value_symbol().empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_any_input_changed(const ov::Node& node, const std::unordered_set<const ov::Node*>& changed_outputs) {
+    for (const auto& input : node.inputs()) {
+        if (changed_outputs.count(input.get_source_output().get_node())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Mode of the validation of the changed nodes set by OV_VALIDATE_CHANGED_NODES environment variable:
+ * "1", "true" or "on" enables it, "check" enables it and compares its results with the full validation of the model.
+ * Disabled by default, so the whole model is validated each time.
+ */
+enum class ChangedNodesValidation { DISABLED, ENABLED, CHECK };
+
+ChangedNodesValidation get_changed_nodes_validation() {
+    static const auto mode = []() {
+        const auto value = ov::util::to_lower(ov::util::getenv_string("OV_VALIDATE_CHANGED_NODES"));
+        if (value == "1" || value == "true" || value == "on")
+            return ChangedNodesValidation::ENABLED;
+        if (value == "check")
+            return ChangedNodesValidation::CHECK;
+        return ChangedNodesValidation::DISABLED;
+    }();
+    return mode;
+}
+
+bool is_changed_nodes_validation_enabled(const ov::SharedRTInfo& info) {
+    return get_changed_nodes_validation() != ChangedNodesValidation::DISABLED ||
+           info.get_validate_changed_nodes() || info.get_check_changes_validation();
+}
+
 }  // namespace
 
 ov::Model::Model(const ResultVector& results, const ov::ParameterVector& parameters, const std::string& name)
@@ -240,20 +313,69 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
 
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
+    validate_nodes_and_infer_types([](const std::shared_ptr<Node>& node) {
+        node->revalidate_and_infer_types();
+    });
+}
 
-    std::stringstream unregistered_parameters;
-    std::stringstream unregistered_variables;
-    std::unordered_set<const ov::descriptor::Tensor*> tensors;
+void ov::Model::validate_changed_nodes_and_infer_types() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_changed_nodes_and_infer_types");
+    // the changes are tracked only if the validation of the changed nodes is enabled
+    if (!m_shared_rt_info->get_track_changes()) {
+        validate_nodes_and_infer_types();
+        return;
+    }
+
+    // The nodes which outputs are changed by the revalidation, so their consumers have to be revalidated too
+    std::unordered_set<const Node*> changed_outputs;
+    validate_nodes_and_infer_types([&](const std::shared_ptr<Node>& node) {
+        // the attributes of the Parameters may be changed in place, e.g. by set_partial_shape(), the revalidation
+        // of the nodes without inputs is cheap
+        const bool is_source = node->get_input_size() == 0 && !ov::op::util::is_constant(node);
+        if (!is_source && !m_shared_rt_info->is_changed(node.get()) && !is_any_input_changed(*node, changed_outputs))
+            return;
 
-    for (auto& node : get_ordered_ops()) {
+        const auto output_types = get_output_types(*node);
+        const auto output_symbols = get_output_symbols(*node);
+        const bool used_values = !is_source && may_have_used_values(*node);
         node->revalidate_and_infer_types();
-        for (const auto& output : node->outputs()) {
-            const auto& tensor = output.get_tensor();
-            // Skip results outputs tensors because result_input_tensor == result_output_tensor
-            if (tensors.count(&tensor))
-                continue;
-            tensors.insert(&tensor);
+        if (used_values || get_output_types(*node) != output_types || get_output_symbols(*node) != output_symbols) {
+            changed_outputs.insert(node.get());
+        }
+    });
+
+    if (get_changed_nodes_validation() == ChangedNodesValidation::CHECK ||
+        m_shared_rt_info->get_check_changes_validation()) {
+        const auto ordered_ops = get_ordered_ops();
+        std::vector<OutputTypes> output_types;
+        output_types.reserve(ordered_ops.size());
+        for (const auto& node : ordered_ops) {
+            output_types.push_back(get_output_types(*node));
         }
+        validate_nodes_and_infer_types();
+        for (size_t i = 0; i < ordered_ops.size(); ++i) {
+            OPENVINO_ASSERT(get_output_types(*ordered_ops[i]) == output_types[i],
+                            "Validation of the changed nodes of the model '",
+                            get_friendly_name(),
+                            "' differs from the full validation for ",
+                            ordered_ops[i],
+                            ". The node or its inputs were changed without tracking.");
+        }
+    }
+}
+
+void ov::Model::validate_nodes_and_infer_types(
+    const std::function<void(const std::shared_ptr<Node>&)>& validate_node) const {
+    // marks the nodes added to the model as changed
+    const auto ordered_ops = get_ordered_ops();
+    // the changes are tracked again after the successful validation only
+    m_shared_rt_info->set_track_changes(false);
+
+    std::stringstream unregistered_parameters;
+    std::stringstream unregistered_variables;
+
+    for (auto& node : ordered_ops) {
+        validate_node(node);
         if (op::util::is_parameter(node) &&
             std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
             unregistered_parameters << node << std::endl;
@@ -281,6 +403,9 @@ void ov::Model::validate_nodes_and_infer_types() const {
                         " is incompatible with layout ",
                         ov::layout::get_layout(output).to_string());
     }
+
+    // mark_changed() is a no-op unless the validation of the changed nodes is enabled for the model
+    m_shared_rt_info->set_track_changes(is_changed_nodes_validation_enabled(*m_shared_rt_info));
 }
 
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
@@ -316,7 +441,10 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         m_cached_ops.insert(node.get());
-        node->insert_info(m_shared_rt_info);
+        // the nodes added since the previous sort have to be validated
+        if (node->insert_info(m_shared_rt_info)) {
+            m_shared_rt_info->mark_changed(node.get());
+        }
     });
     m_cached_output_names.clear();
     m_cached_op_names.clear();
@@ -940,7 +1068,10 @@ ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
             // Full update of topological cache is not needed, 'result' can be just inserted to the end
             m_cached_ordered_ops.push_back(result);
             m_cached_ops.insert(result.get());
-            result->insert_info(m_shared_rt_info);  // Just for consistency, not required for Result nodes
+            // Just for consistency, not required for Result nodes
+            if (result->insert_info(m_shared_rt_info)) {
+                m_shared_rt_info->mark_changed(result.get());
+            }
         } else {
             m_shared_rt_info->set_use_topological_cache(false);
         }
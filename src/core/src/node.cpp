@@ -91,9 +91,9 @@ ov::Node& ov::Node::operator=(const Node& node) {
     return *this;
 }
 
-void ov::Node::insert_info(std::shared_ptr<SharedRTInfo> info) {
+bool ov::Node::insert_info(std::shared_ptr<SharedRTInfo> info) {
     std::lock_guard<std::mutex> lock(m_insert_mutex);
-    m_shared_rt_info.insert(std::move(info));
+    return m_shared_rt_info.insert(std::move(info)).second;
 }
 
 ov::Node::Node(size_t output_size) : Node() {
@@ -205,9 +205,12 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
     }
 
     // set_arguments doesn't use replace_output method, so we have to reset cache manually here
-    for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
-        info->set_use_topological_cache(false);
-    });
+    for_each(this->m_shared_rt_info.cbegin(),
+             this->m_shared_rt_info.cend(),
+             [this](const std::shared_ptr<SharedRTInfo>& info) {
+                 info->set_use_topological_cache(false);
+                 info->mark_changed(this);
+             });
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
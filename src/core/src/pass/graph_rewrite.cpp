@@ -5,10 +5,14 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -16,9 +20,13 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
+#include "shared_node_info.hpp"
 
 /* GraphRewrite algorithm:
  * GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -66,6 +74,131 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT
+
+namespace ov {
+namespace pass {
+namespace {
+// Collects the types of the nodes which can be matched by the pattern root. If root is an operation from opset or has
+// pattern::op::WrapType type then we can extract it's type and use it as key for fast MatcherPass search. The
+// alternatives of pattern::op::Or are collected recursively. Returns false if any of the types is unknown.
+bool collect_root_types(std::shared_ptr<Node> root, std::vector<NodeTypeInfo>& types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
+        root = any_type->input_value(0).get_node_shared_ptr();
+    }
+
+    if (!std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        types.push_back(root->get_type_info());
+        return true;
+    }
+    if (auto wrap_type = ov::as_type_ptr<pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (ov::is_type<pattern::op::Or>(root)) {
+        for (const auto& input : root->input_values()) {
+            if (!collect_root_types(input.get_node_shared_ptr(), types))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief MatcherPassStatistics collects the number of calls, successful applications and the time of each MatcherPass
+ * of GraphRewrite. It is enabled by the same OV_ENABLE_PROFILE_PASS environment variable as the profiling of the
+ * passes in pass::Manager: the statistics are printed to the console if it is "true", "on" or "1", or are appended to
+ * the file if it contains a path, one line per MatcherPass:
+ *     mp;<MatcherPass name>;<GraphRewrite name>;<time in ns>;<calls>;<applied>
+ */
+class MatcherPassStatistics {
+public:
+    explicit MatcherPassStatistics(size_t matchers_count) {
+        if (is_enabled()) {
+            m_statistics.resize(matchers_count);
+        }
+    }
+
+    bool is_enabled() const {
+        return !get_output().empty();
+    }
+
+    bool apply(size_t matcher_index, MatcherPass& pass, std::shared_ptr<Node> node) {
+        auto& statistics = m_statistics[matcher_index];
+        const auto start = std::chrono::steady_clock::now();
+        const bool status = pass.apply(std::move(node));
+        statistics.time += std::chrono::steady_clock::now() - start;
+        statistics.calls++;
+        statistics.applied += status ? 1 : 0;
+        return status;
+    }
+
+    void report(const std::string& graph_rewrite_name, const std::vector<std::shared_ptr<MatcherPass>>& matchers) const {
+        if (!is_enabled())
+            return;
+
+        std::vector<size_t> order;
+        for (size_t i = 0; i < m_statistics.size(); ++i) {
+            if (m_statistics[i].calls != 0)
+                order.push_back(i);
+        }
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return m_statistics[lhs].time > m_statistics[rhs].time;
+        });
+
+        const auto& output = get_output();
+        if (output == "console") {
+            for (size_t i : order) {
+                const auto& statistics = m_statistics[i];
+                std::cout << "    " << std::setw(60) << std::left << matchers[i]->get_name() << std::setw(8)
+                          << std::right
+                          << std::chrono::duration_cast<std::chrono::microseconds>(statistics.time).count() << "us "
+                          << statistics.applied << "/" << statistics.calls << std::endl;
+            }
+        } else {
+            std::ofstream file(output, std::ios_base::app);
+            OPENVINO_ASSERT(file.is_open(),
+                            "The output file for logging MatcherPass statistics cannot be opened: ",
+                            output);
+            for (size_t i : order) {
+                const auto& statistics = m_statistics[i];
+                file << "mp;" << matchers[i]->get_name() << ";" << graph_rewrite_name << ";"
+                     << std::chrono::duration_cast<std::chrono::nanoseconds>(statistics.time).count() << ";"
+                     << statistics.calls << ";" << statistics.applied << std::endl;
+            }
+        }
+    }
+
+private:
+    struct Statistics {
+        std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+        size_t calls = 0;
+        size_t applied = 0;
+    };
+
+    // "console", a path to the output file or an empty string if the statistics are disabled
+    static const std::string& get_output() {
+        static const std::string output = []() -> std::string {
+            const auto value = ov::util::getenv_string("OV_ENABLE_PROFILE_PASS");
+            const auto value_lower = ov::util::to_lower(value);
+            if (value_lower.empty() || value_lower == "0" || value_lower == "false" || value_lower == "off")
+                return {};
+            if (value_lower == "1" || value_lower == "true" || value_lower == "on")
+                return "console";
+            return value;
+        }();
+        return output;
+    }
+
+    std::vector<Statistics> m_statistics;
+};
+}  // namespace
+}  // namespace pass
+}  // namespace ov
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,52 +234,55 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // MatcherPasses are bucketed by the types of their pattern roots, so every node is checked only by the
+    // MatcherPasses which can match it. MatcherPasses with the roots of unknown type (e.g. pattern::any_input or
+    // a Label with a predicate) are checked for every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        root_types.clear();
+        if (!matcher || !collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            any_type_matchers.push_back(matcher_index);
+            continue;
         }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        for (const auto& root_type_info : root_types) {
+            type_to_matcher[root_type_info].push_back(matcher_index);
         }
+    }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+    // The MatcherPasses to run for the nodes of a type: the ones registered for the type and for its parents and the
+    // ones of unknown root type in the order of the registration. Is filled on the first node of the type
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> matchers_by_node_type;
+    auto get_matchers = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = matchers_by_node_type.find(&type_info);
+        if (it != matchers_by_node_type.end()) {
+            return it->second;
+        }
+        std::vector<size_t> matchers = any_type_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto type_matchers = type_to_matcher.find(*node_type_info);
+            if (type_matchers != type_to_matcher.end()) {
+                matchers.insert(matchers.end(), type_matchers->second.begin(), type_matchers->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        std::sort(matchers.begin(), matchers.end());
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return matchers_by_node_type.emplace(&type_info, std::move(matchers)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    MatcherPassStatistics statistics(m_matchers.size());
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -159,7 +295,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = statistics.is_enabled() ? statistics.apply(matcher_index, *m_pass, std::move(node))
+                                              : m_pass->apply(std::move(node));
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -175,9 +312,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -192,7 +326,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
-                    run_on_model(sub_graph);
+                    if (run_on_model(sub_graph)) {
+                        // the output shapes of the node depend on the body
+                        SharedRTInfo::mark_node_changed(*sub_graph_node);
+                    }
                 }
             }
         }
@@ -200,50 +337,16 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node->get_type_info())) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
     }
+
+    statistics.report(get_name(), m_matchers);
     return rewritten;
 }
 
@@ -289,6 +392,13 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
 
             try {
                 const bool status = callback(*m.get());
+                if (status) {
+                    // the callback may change the attributes of the matched nodes in place, so they have to be
+                    // revalidated by the validation of the changed nodes
+                    for (const auto& matched_node : m->get_matched_nodes()) {
+                        SharedRTInfo::mark_node_changed(*matched_node);
+                    }
+                }
                 // explicitly clear Matcher state because it holds pointers to matched nodes
                 m->clear_state();
                 OPENVINO_LOG_GRAPH_REWRITE2(m, status);
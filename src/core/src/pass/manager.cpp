@@ -334,15 +334,26 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
 
     bool model_changed = false;
     bool pass_changed_model = false;
+    // The Validate pass revalidates only the changed nodes if all the changes since the previous validation were made
+    // by GraphRewrites which track them. The first validation is always full as the model could be changed before.
+    bool validate_changed_nodes = false;
 
     profiler.start_timer(m_name);
     for (const auto& pass : m_pass_list) {
         const auto& pass_name = pass->get_name();
 
         profiler.start_timer(pass_name);
-        pass_changed_model = run_pass(pass, model, pass_changed_model);
+        const bool needs_validate = pass_changed_model;
+        pass_changed_model = run_pass(pass, model, needs_validate, validate_changed_nodes);
         profiler.stop_timer(pass_name, pass_changed_model);
 
+        if (ov::as_type_ptr<Validate>(pass)) {
+            validate_changed_nodes = validate_changed_nodes || needs_validate;
+        } else if (!ov::as_type_ptr<GraphRewrite>(pass) && !ov::as_type_ptr<MatcherPass>(pass)) {
+            // other passes may change the nodes in place without tracking
+            validate_changed_nodes = false;
+        }
+
         model_changed = model_changed || pass_changed_model;
 
         profiler.visualize(model, pass_name);
@@ -355,7 +366,8 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
 
 bool ov::pass::Manager::run_pass(const std::shared_ptr<PassBase>& pass,
                                  const std::shared_ptr<Model>& model,
-                                 bool needs_validate) {
+                                 bool needs_validate,
+                                 bool validate_changed_nodes) {
     if (m_pass_config->is_disabled(pass->get_type_info())) {
         OPENVINO_DEBUG("Pass ", pass->get_name(), " is disabled.");
         return false;
@@ -377,8 +389,14 @@ bool ov::pass::Manager::run_pass(const std::shared_ptr<PassBase>& pass,
         // GraphRewrite is a temporary container for MatcherPass to make execution on entire ov::Model
         return GraphRewrite(matcher_pass).run_on_model(model);
     } else if (auto model_pass = ov::as_type_ptr<ModelPass>(pass)) {
-        if (ov::as_type_ptr<ov::pass::Validate>(model_pass) && !needs_validate) {
-            return false;
+        if (ov::as_type_ptr<ov::pass::Validate>(model_pass)) {
+            if (!needs_validate) {
+                return false;
+            }
+            if (validate_changed_nodes) {
+                model->validate_changed_nodes_and_infer_types();
+                return false;
+            }
         }
         return model_pass->run_on_model(model);
     }
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_set>
 
 namespace ov {
 class SharedRTInfo {
@@ -21,7 +24,71 @@ public:
         return m_use_topological_cache;
     }
 
+    /// \brief Starts (or stops) tracking of the nodes changed since the last validation of the Model.
+    /// The previously tracked changes are dropped on start. The validation of the Model starts the tracking only if
+    /// the validation of the changed nodes is enabled, otherwise mark_changed() is a no-op.
+    void set_track_changes(bool status) {
+        std::lock_guard<std::mutex> lock(m_changes_mutex);
+        if (status) {
+            m_changed_nodes.clear();
+        }
+        m_track_changes = status;
+    }
+
+    bool get_track_changes() const {
+        return m_track_changes;
+    }
+
+    /// \brief Marks the node which inputs or attributes were changed, so it has to be revalidated
+    void mark_changed(const Node* node) {
+        if (!m_track_changes)
+            return;
+        std::lock_guard<std::mutex> lock(m_changes_mutex);
+        m_changed_nodes.insert(node);
+    }
+
+    bool is_changed(const Node* node) const {
+        std::lock_guard<std::mutex> lock(m_changes_mutex);
+        return m_changed_nodes.count(node) != 0;
+    }
+
+    /// \brief Marks the node as changed in all Models it belongs to
+    static void mark_node_changed(const Node& node) {
+        for (const auto& info : node.m_shared_rt_info) {
+            info->mark_changed(&node);
+        }
+    }
+
+    /// \brief Enables the validation of the changed nodes only for the Model regardless of OV_VALIDATE_CHANGED_NODES.
+    /// The changes are tracked since the next validation of the Model.
+    void set_validate_changed_nodes(bool status) {
+        m_validate_changed_nodes = status;
+    }
+
+    bool get_validate_changed_nodes() const {
+        return m_validate_changed_nodes;
+    }
+
+    /// \brief Enables the validation of the changed nodes only for the Model and checks its result against the full
+    /// validation of the Model
+    void set_check_changes_validation(bool status) {
+        m_check_changes_validation = status;
+    }
+
+    bool get_check_changes_validation() const {
+        return m_check_changes_validation;
+    }
+
 private:
     bool m_use_topological_cache;
+
+    // The changed nodes are never dereferenced: a deleted node is no longer in the Model,
+    // so a reused address may only cause an extra revalidation
+    std::atomic_bool m_track_changes{false};
+    std::unordered_set<const Node*> m_changed_nodes;
+    mutable std::mutex m_changes_mutex;
+
+    bool m_validate_changed_nodes = false;
+    bool m_check_changes_validation = false;
 };
 }  // namespace ov
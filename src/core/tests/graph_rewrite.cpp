@@ -16,6 +16,8 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +271,49 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPassOrder) {
+    auto f = get_derived_model();
+    const auto ordered_ops = f->get_ordered_ops();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    // the matcher with any root type doesn't prevent the type based ones from being applied in the registration order
+    ASSERT_EQ(order, ordered_ops);
+    ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
+}
+
+class OrRootTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("OrRootTestPass");
+    OrRootTestPass() : MatcherPass() {
+        auto root = std::make_shared<pattern::op::Or>(
+            OutputVector{pattern::wrap_type<op::v0::Tanh>(), pattern::wrap_type<op::v1::Divide>()});
+        ov::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto relu = std::make_shared<ov::op::v0::Relu>(m.get_match_root()->input_value(0));
+            ov::replace_node(m.get_match_root(), relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(root, "OrRootTestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, OrRootMatcherPass) {
+    auto f = get_derived_model();
+
+    Anchor anchor;
+    anchor.add_matcher<OrRootTestPass>();
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -9,15 +9,24 @@
 #include <string>
 #include <vector>
 
+#include "common_test_utils/ov_test_utils.hpp"
+#include "common_test_utils/test_common.hpp"
 #include "common_test_utils/test_tools.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/op.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/tanh.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/pass/matcher_pass.hpp"
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "shared_node_info.hpp"
 
 using namespace ov;
 using namespace std;
@@ -90,3 +99,142 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+namespace {
+
+class ValidationCountingOp : public ov::op::Op {
+public:
+    OPENVINO_OP("ValidationCountingOp");
+
+    ValidationCountingOp(const Output<Node>& arg, size_t& validations) : Op({arg}), m_validations(validations) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        ++m_validations;
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<ValidationCountingOp>(new_args.at(0), m_validations);
+    }
+
+private:
+    size_t& m_validations;
+};
+
+template <class To>
+ov::matcher_pass_callback replace_with() {
+    return [](ov::pass::pattern::Matcher& m) {
+        const auto& node = m.get_match_root();
+        return ov::replace_node_update_name(node, std::make_shared<To>(node->input_value(0)));
+    };
+}
+
+class ReplaceReluWithTanh : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ReplaceReluWithTanh");
+    ReplaceReluWithTanh() {
+        auto root = ov::pass::pattern::wrap_type<ov::op::v0::Relu>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(root, "ReplaceReluWithTanh"),
+                         replace_with<ov::op::v0::Tanh>());
+    }
+};
+
+class ReplaceTanhWithRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ReplaceTanhWithRelu");
+    ReplaceTanhWithRelu() {
+        auto root = ov::pass::pattern::wrap_type<ov::op::v0::Tanh>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(root, "ReplaceTanhWithRelu"),
+                         replace_with<ov::op::v0::Relu>());
+    }
+};
+
+// Changes the Convert which is not matched without the tracking of the changes
+class ChangeConvertInPlace : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ChangeConvertInPlace");
+    ChangeConvertInPlace(const std::shared_ptr<ov::op::v0::Convert>& convert) {
+        auto root = ov::pass::pattern::wrap_type<ov::op::v0::Tanh>();
+        ov::matcher_pass_callback callback = [convert](ov::pass::pattern::Matcher& m) {
+            convert->set_convert_element_type(ov::element::i32);
+            return replace_with<ov::op::v0::Relu>()(m);
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(root, "ChangeConvertInPlace"), callback);
+    }
+};
+
+}  // namespace
+
+TEST(pass_manager, validate_changed_nodes) {
+    size_t consumer_validations = 0;
+    size_t next_consumer_validations = 0;
+    size_t other_branch_validations = 0;
+    auto arg_0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto arg_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(arg_0);
+    auto consumer = std::make_shared<ValidationCountingOp>(relu, consumer_validations);
+    auto next_consumer = std::make_shared<ValidationCountingOp>(consumer, next_consumer_validations);
+    auto other_branch = std::make_shared<ValidationCountingOp>(arg_1, other_branch_validations);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{next_consumer, other_branch},
+                                             ov::ParameterVector{arg_0, arg_1});
+    ov::ModelAccessor(model).get_shared_info()->set_check_changes_validation(true);
+    consumer_validations = next_consumer_validations = other_branch_validations = 0;
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ReplaceReluWithTanh>();
+    pass_manager.register_pass<ReplaceTanhWithRelu>();
+    pass_manager.run_passes(model);
+
+    // The first validation is full. The second one revalidates the consumer of the replaced node only as its output
+    // shape is not changed. The check of the validation of the changed nodes runs the full validation once again.
+    EXPECT_EQ(consumer_validations, 3U);
+    EXPECT_EQ(next_consumer_validations, 2U);
+    EXPECT_EQ(other_branch_validations, 2U);
+    EXPECT_EQ(count_ops_of_type<ov::op::v0::Relu>(model), 1U);
+}
+
+TEST(pass_manager, validate_changed_nodes_check_detects_untracked_changes) {
+    auto arg_0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto arg_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(arg_0);
+    auto convert = std::make_shared<ov::op::v0::Convert>(arg_1, ov::element::f16);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu, convert}, ov::ParameterVector{arg_0, arg_1});
+    ov::ModelAccessor(model).get_shared_info()->set_check_changes_validation(true);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ReplaceReluWithTanh>();
+    pass_manager.register_pass<ChangeConvertInPlace>(convert);
+    EXPECT_THROW(pass_manager.run_passes(model), ov::Exception);
+}
+
+TEST(pass_manager, validate_changed_nodes_disabled_by_default) {
+    auto arg_0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto arg_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(arg_0);
+    auto convert = std::make_shared<ov::op::v0::Convert>(arg_1, ov::element::f16);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu, convert}, ov::ParameterVector{arg_0, arg_1});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ReplaceReluWithTanh>();
+    pass_manager.register_pass<ChangeConvertInPlace>(convert);
+    OV_ASSERT_NO_THROW(pass_manager.run_passes(model));
+    EXPECT_EQ(convert->get_output_element_type(0), ov::element::i32);
+}
+
+TEST(pass_manager, changes_are_tracked_for_validate_changed_nodes_only) {
+    auto arg = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(arg);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{arg});
+    const auto shared_info = ov::ModelAccessor(model).get_shared_info();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ReplaceReluWithTanh>();
+    pass_manager.run_passes(model);
+    EXPECT_FALSE(shared_info->get_track_changes());
+
+    shared_info->set_validate_changed_nodes(true);
+    pass_manager.run_passes(model);
+    EXPECT_TRUE(shared_info->get_track_changes());
+}
@@ -5,10 +5,12 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <future>
 #include <pugixml.hpp>
 #include <vector>
 
 #include "input_model.hpp"
+#include "itt.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
@@ -39,6 +41,9 @@ size_t get_ir_version(const pugi::xml_document& doc) {
 
 constexpr size_t HEADER_SIZE_LIM = 512lu;
 
+// the weights smaller than this are read in place, since starting a thread takes longer than their reading
+constexpr size_t ASYNC_WEIGHTS_READING_MIN_SIZE = 16lu * 1024 * 1024;
+
 /**
  * @brief Extracts IR version from model stream
  * @param model Model's stream
@@ -159,6 +164,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ov::AlignedBuffer> model_buf;
     std::shared_ptr<ov::AlignedBuffer> weights;
+    InputModel::WeightsReading weights_reading;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -174,16 +180,22 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             return std::make_shared<InputModel>(*provided_model_stream,
                                                 weights,
                                                 create_extensions_map(),
-                                                std::move(weights_path));
+                                                std::move(weights_path),
+                                                weights_reading);
         } else if (local_model_stream.is_open()) {
             auto input_model = std::make_shared<InputModel>(local_model_stream,
                                                             weights,
                                                             create_extensions_map(),
-                                                            std::move(weights_path));
+                                                            std::move(weights_path),
+                                                            weights_reading);
             local_model_stream.close();
             return input_model;
         } else if (model_buf) {
-            return std::make_shared<InputModel>(model_buf, weights, create_extensions_map(), std::move(weights_path));
+            return std::make_shared<InputModel>(model_buf,
+                                                weights,
+                                                create_extensions_map(),
+                                                std::move(weights_path),
+                                                weights_reading);
         }
         return nullptr;
     };
@@ -275,8 +287,17 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             bin_stream.seekg(0, std::ios::beg);
 
             auto aligned_weights_buffer = std::make_shared<ov::AlignedBuffer>(file_size);
-            bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-            bin_stream.close();
+            auto read_weights = [bin_stream = std::move(bin_stream), aligned_weights_buffer]() mutable {
+                OV_ITT_SCOPED_TASK(ov::itt::domains::ir_frontend, "FrontEnd::ReadWeights");
+                bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+                bin_stream.close();
+            };
+            if (file_size >= ASYNC_WEIGHTS_READING_MIN_SIZE) {
+                // the weights are read while the model XML is parsed, the conversion waits for the reading to complete
+                weights_reading = std::async(std::launch::async, std::move(read_weights)).share();
+            } else {
+                read_weights();
+            }
 
             weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
                 aligned_weights_buffer->get_ptr<char>(),
@@ -7,6 +7,7 @@
 #include <pugixml.hpp>
 
 #include "ir_deserializer.hpp"
+#include "itt.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/concat.hpp"
@@ -206,15 +207,19 @@ class InputModel::InputModelIRImpl {
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
     std::string m_weights_path;
+    WeightsReading m_weights_reading;
 
 public:
     InputModelIRImpl(std::istream& model,
                      const std::shared_ptr<ov::AlignedBuffer>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                     std::string weights_path)
+                     std::string weights_path,
+                     WeightsReading weights_reading)
         : m_weights(weights),
           m_extensions(extensions),
-          m_weights_path(std::move(weights_path)) {
+          m_weights_path(std::move(weights_path)),
+          m_weights_reading(std::move(weights_reading)) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::ir_frontend, "InputModel::ParseXml");
         pugi::xml_parse_result res = m_xml_doc.load(model);
         OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
         init_opset();
@@ -223,10 +228,13 @@ public:
     InputModelIRImpl(const std::shared_ptr<ov::AlignedBuffer>& model,
                      const std::shared_ptr<ov::AlignedBuffer>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                     std::string weights_path)
+                     std::string weights_path,
+                     WeightsReading weights_reading)
         : m_weights(weights),
           m_extensions(extensions),
-          m_weights_path(std::move(weights_path)) {
+          m_weights_path(std::move(weights_path)),
+          m_weights_reading(std::move(weights_reading)) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::ir_frontend, "InputModel::ParseXml");
         auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
         init_opset();
@@ -246,15 +254,25 @@ private:
 InputModel::InputModel(std::istream& model,
                        const std::shared_ptr<ov::AlignedBuffer>& weights,
                        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                       std::string weights_path) {
-    _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
+                       std::string weights_path,
+                       WeightsReading weights_reading) {
+    _impl = std::make_shared<InputModelIRImpl>(model,
+                                               weights,
+                                               extensions,
+                                               std::move(weights_path),
+                                               std::move(weights_reading));
 }
 
 InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
                        const std::shared_ptr<ov::AlignedBuffer>& weights,
                        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                       std::string weights_path) {
-    _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
+                       std::string weights_path,
+                       WeightsReading weights_reading) {
+    _impl = std::make_shared<InputModelIRImpl>(model,
+                                               weights,
+                                               extensions,
+                                               std::move(weights_path),
+                                               std::move(weights_reading));
 }
 
 std::shared_ptr<ov::Model> InputModel::convert() {
@@ -264,6 +282,13 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
+    // the weights have to be read completely before the constants are created
+    if (m_weights_reading.valid()) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::ir_frontend, "InputModel::WaitWeights");
+        m_weights_reading.get();
+    }
+
+    OV_ITT_SCOPED_TASK(ov::itt::domains::ir_frontend, "InputModel::BuildModel");
     // Load default opsets
     size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
     ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
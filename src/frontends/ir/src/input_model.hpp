@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <istream>
 #include <memory>
 
@@ -20,15 +21,20 @@ class InputModel : public ov::frontend::InputModel {
     std::shared_ptr<InputModelIRImpl> _impl;
 
 public:
+    /// \brief The reading of the weights which may be still in progress while the model XML is parsed
+    using WeightsReading = std::shared_future<void>;
+
     InputModel(std::istream& stream,
                const std::shared_ptr<ov::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-               std::string weights_path = {});
+               std::string weights_path = {},
+               WeightsReading weights_reading = {});
 
     InputModel(const std::shared_ptr<ov::AlignedBuffer>& model_buf,
                const std::shared_ptr<ov::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-               std::string weights_path = {});
+               std::string weights_path = {},
+               WeightsReading weights_reading = {});
 
     std::shared_ptr<Model> convert();
 };
@@ -4,10 +4,15 @@
 
 #include "ir_deserializer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <pugixml.hpp>
 #include <regex>
 #include <stack>
 #include <string_view>
+#include <thread>
 
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/except.hpp"
@@ -28,6 +33,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
@@ -71,6 +77,84 @@ std::unordered_set<std::string> deserialize_tensor_names(const std::string_view&
 
     return output_names;
 }
+
+/**
+ * @brief Hints the OS to read ahead the weights regions in the given order by the background thread.
+ *
+ * The mapped weights file is read lazily on the first access to each page, so the regions are prefetched in the order
+ * the constants are created, and the pages are already in memory when the model is compiled. The prefetching stops
+ * when the prefetcher is destroyed, i.e. when the model is built.
+ */
+class WeightsPrefetcher {
+public:
+    // the prefetching pays off for the large weights only
+    static constexpr size_t min_size = 64 * 1024 * 1024;
+
+    WeightsPrefetcher(std::shared_ptr<ov::AlignedBuffer> weights, std::vector<std::pair<size_t, size_t>> regions) {
+        m_thread = std::thread([this, weights = std::move(weights), regions = std::move(regions)]() {
+            // the large regions are split, so the prefetching is stopped promptly
+            constexpr size_t chunk_size = 16 * 1024 * 1024;
+            for (const auto& region : regions) {
+                for (size_t offset = 0; offset < region.second; offset += chunk_size) {
+                    if (m_stop.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    ov::prefetch_memory(weights->get_ptr<char>() + region.first + offset,
+                                        std::min(chunk_size, region.second - offset));
+                }
+            }
+        });
+    }
+
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+
+    ~WeightsPrefetcher() {
+        m_stop = true;
+        m_thread.join();
+    }
+
+private:
+    std::atomic_bool m_stop{false};
+    std::thread m_thread;
+};
+
+/**
+ * @brief Calls the function for each index in [0, size) using several threads.
+ *
+ * The exception of the smallest failed index is rethrown, so the error does not depend on the threads scheduling.
+ */
+template <typename F>
+void parallel_for_each(size_t size, size_t min_per_thread, const F& func) {
+    const size_t nthreads =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), std::max<size_t>(size / min_per_thread, 1));
+    std::vector<std::exception_ptr> errors(size);
+    std::atomic_size_t next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < size; i = next++) {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < nthreads; ++i) {
+        workers.emplace_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& w : workers) {
+        w.wait();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
 }  // namespace
 
 ov::XmlDeserializer::IoMap ov::XmlDeserializer::updated_io_map(const pugi::xml_node& node,
@@ -558,6 +642,49 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // The constants do not depend on the other nodes, so they are created in advance by several threads if there are
+    // many of them, and their weights are prefetched in the same order.
+    std::vector<size_t> const_ids;
+    std::vector<std::pair<size_t, size_t>> const_regions;
+    size_t const_regions_size = 0;
+    for (const auto& layer_id : order) {
+        const auto& p = params[layer_id];
+        if (p.params.type != "Const" || !edges[layer_id].empty()) {
+            continue;
+        }
+        const_ids.push_back(layer_id);
+        const auto data = p.xml.child("data");
+        if (weights && data.attribute("offset") && data.attribute("size")) {
+            const auto offset = static_cast<size_t>(pugixml::get_uint64_attr(data, "offset"));
+            const auto size = static_cast<size_t>(pugixml::get_uint64_attr(data, "size"));
+            if (offset + size <= weights->size()) {
+                const_regions.emplace_back(offset, size);
+                const_regions_size += size;
+            }
+        }
+    }
+    std::unique_ptr<WeightsPrefetcher> prefetcher;
+    if (const_regions_size >= WeightsPrefetcher::min_size) {
+        prefetcher = std::make_unique<WeightsPrefetcher>(weights, std::move(const_regions));
+    }
+
+    std::unordered_map<size_t, std::shared_ptr<ov::Node>> constants;
+    // the constants are created by the opset unless an extension overrides them
+    constexpr size_t min_constants_per_thread = 256;
+    const bool const_extension = std::any_of(m_extensions.begin(), m_extensions.end(), [](const auto& extension) {
+        return std::string(extension.first.name) == ov::op::v0::Constant::get_type_info_static().name;
+    });
+    if (const_ids.size() >= 2 * min_constants_per_thread && !const_extension) {
+        std::vector<std::shared_ptr<ov::Node>> nodes(const_ids.size());
+        parallel_for_each(const_ids.size(), min_constants_per_thread, [&](size_t i) {
+            const auto& p = params.at(const_ids[i]);
+            nodes[i] = create_node({}, p.xml, weights, p.params);
+        });
+        for (size_t i = 0; i < const_ids.size(); ++i) {
+            constants[const_ids[i]] = std::move(nodes[i]);
+        }
+    }
+
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
@@ -586,7 +713,8 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        const auto constant = constants.find(layer_id);
+        auto node = constant != constants.end() ? constant->second : create_node(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
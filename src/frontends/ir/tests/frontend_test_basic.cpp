@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <numeric>
+
 #include "common_test_utils/test_assertions.hpp"
 #include "frontend_test.hpp"
 #include "openvino/op/add.hpp"
@@ -11,6 +13,7 @@
 #include "openvino/opsets/opset1_decl.hpp"
 #include "openvino/opsets/opset3_decl.hpp"
 #include "openvino/opsets/opset6_decl.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "utils.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
@@ -568,6 +571,84 @@ TEST_P(IRFrontendMMapTests, model_with_lp_weights_reading_from_disk) {
     }
 }
 
+TEST_P(IRFrontendMMapTests, model_with_many_constants_reading_from_disk) {
+    // the number of the constants is large enough to create them in parallel
+    constexpr size_t num_constants = 1024;
+    auto make_model = [&]() {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        parameter->set_friendly_name("input");
+        ov::Output<ov::Node> output = parameter;
+        for (size_t i = 0; i < num_constants; ++i) {
+            auto constant = std::make_shared<ov::opset1::Constant>(ov::element::f32,
+                                                                   ov::Shape{1, 16},
+                                                                   std::vector<float>(16, static_cast<float>(i)));
+            constant->set_friendly_name("value" + std::to_string(i));
+            auto add = std::make_shared<ov::opset1::Add>(output, constant);
+            add->set_friendly_name("add" + std::to_string(i));
+            output = add;
+        }
+        auto result = std::make_shared<ov::opset1::Result>(output);
+        result->set_friendly_name("output");
+        return std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{parameter});
+    };
+
+    auto filePrefix = ov::test::utils::generateTestFilePrefix();
+    xmlFileName = filePrefix + "_IrFrontendTestModel.xml";
+    binFileName = filePrefix + "_IrFrontendTestModel.bin";
+    ov::serialize(make_model(), xmlFileName, binFileName);
+
+    std::shared_ptr<ov::Model> model;
+    ov::Core new_core;
+    new_core.set_property(ov::enable_mmap(GetParam()));
+    OV_ASSERT_NO_THROW(model = new_core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, make_model());
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_P(IRFrontendMMapTests, model_with_large_weights_reading_from_disk) {
+    // the weights are large enough to be read while the model XML is parsed
+    constexpr size_t weights_size = 16 * 1024 * 1024 / sizeof(float) + 1;
+    auto make_model = [&]() {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{weights_size});
+        parameter->set_friendly_name("input");
+        std::vector<float> values(weights_size);
+        std::iota(values.begin(), values.end(), 0.0f);
+        auto constant = std::make_shared<ov::opset1::Constant>(ov::element::f32, ov::Shape{weights_size}, values);
+        constant->set_friendly_name("value");
+        auto add = std::make_shared<ov::opset1::Add>(parameter, constant);
+        add->set_friendly_name("add");
+        auto result = std::make_shared<ov::opset1::Result>(add);
+        result->set_friendly_name("output");
+        return std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{parameter});
+    };
+
+    auto filePrefix = ov::test::utils::generateTestFilePrefix();
+    xmlFileName = filePrefix + "_IrFrontendTestModel.xml";
+    binFileName = filePrefix + "_IrFrontendTestModel.bin";
+    ov::serialize(make_model(), xmlFileName, binFileName);
+
+    std::shared_ptr<ov::Model> model;
+    ov::Core new_core;
+    new_core.set_property(ov::enable_mmap(GetParam()));
+    OV_ASSERT_NO_THROW(model = new_core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, make_model());
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 INSTANTIATE_TEST_SUITE_P(EnableMMapPropery, IRFrontendMMapTests, ::testing::Bool());
 
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
@@ -300,6 +300,8 @@ struct ONNXModelEditor::Impl {
     std::shared_ptr<ModelProto> m_model_proto;
     EdgeMapper m_edge_mapper;
     bool m_is_mapper_updated = false;
+    // The large initializers of the model parsed from the mapped file refer to their data in the file
+    bool m_refers_to_model_file = false;
 
     Impl() = delete;
 
@@ -307,13 +309,27 @@ struct ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
-    Impl(const std::string& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
+    Impl(const std::string& model_path, const bool enable_mmap)
+        : Impl(std::make_shared<ModelProto>(enable_mmap ? parse_from_mapped_file(model_path)
+                                                        : parse_from_file(model_path))) {
+        m_refers_to_model_file = enable_mmap;
+    }
 
     Impl(std::istream& model_stream) : Impl(std::make_shared<ModelProto>(parse_from_istream(model_stream))) {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     Impl(const std::wstring& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
 #endif
+
+    /// \brief Returns the model which doesn't refer to the data in the model file, so it can be serialized anywhere
+    std::shared_ptr<ModelProto> serializable_model_proto(const std::string& model_path) const {
+        if (!m_refers_to_model_file) {
+            return m_model_proto;
+        }
+        auto model_proto = std::make_shared<ModelProto>(*m_model_proto);
+        inline_mapped_file_data(*model_proto, model_path);
+        return model_proto;
+    }
 };
 
 ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
@@ -323,7 +339,7 @@ ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
       m_mmap_cache{enable_mmap ? std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>()
                                : nullptr},
       m_extensions{std::move(extensions)},
-      m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
+      m_pimpl{new ONNXModelEditor::Impl{model_path, enable_mmap}, [](Impl* impl) {
                   delete impl;
               }} {}
 
@@ -365,11 +381,13 @@ const std::string& ONNXModelEditor::model_path() const {
 }
 
 void ONNXModelEditor::serialize(const std::string& out_file_path) const {
+    // the data is read from the model file before it may be overwritten
+    const auto model_proto = m_pimpl->serializable_model_proto(m_model_path);
     std::ofstream out_file{out_file_path, std::ios::out | std::ios::binary};
 
     OPENVINO_ASSERT(out_file.is_open(), "Could not open the file: ", out_file_path);
 
-    OPENVINO_ASSERT(m_pimpl->m_model_proto->SerializeToOstream(&out_file),
+    OPENVINO_ASSERT(model_proto->SerializeToOstream(&out_file),
                     "Could not serialize the model to: ",
                     out_file_path);
     out_file.close();
@@ -538,7 +556,7 @@ bool ONNXModelEditor::is_output(const OutputEdge& edge) const {
 }
 
 std::string ONNXModelEditor::model_string() const {
-    return m_pimpl->m_model_proto->SerializeAsString();
+    return m_pimpl->serializable_model_proto(m_model_path)->SerializeAsString();
 }
 
 std::shared_ptr<Model> ONNXModelEditor::get_function() const {
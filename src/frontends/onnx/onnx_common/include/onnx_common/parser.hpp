@@ -23,6 +23,23 @@ ModelProto parse_from_file(const std::string& file_path);
 ModelProto parse_from_file(const std::wstring& file_path);
 #endif
 
+/// \brief   Parses an ONNX model from a file mapped into memory. The raw data of the large initializers
+///          of the main graph is not copied to the parsed model: these initializers refer to their data
+///          as to the external data stored in the model file itself, so it can be mapped instead of read.
+///          Falls back to parse_from_file if the file can't be mapped or rewritten.
+///
+/// \param   file_path    Path to the file containing an ONNX model.
+///
+/// \return  The parsed in-memory representation of the ONNX model
+ModelProto parse_from_mapped_file(const std::string& file_path);
+
+/// \brief   Returns the data of the initializers which refer to the model file itself, as parse_from_mapped_file
+///          makes them, to their raw data, so the model can be serialized to any location.
+///
+/// \param   model_proto  The model parsed from the file.
+/// \param   file_path    Path to the file containing the ONNX model.
+void inline_mapped_file_data(ModelProto& model_proto, const std::string& file_path);
+
 /// \brief   Parses an ONNX model from a stream (representing for example a file)
 ///
 /// \param   model_stream  Path to the file containing an ONNX model.
@@ -8,8 +8,11 @@
 #include <google/protobuf/text_format.h>
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
+
 #include "openvino/core/except.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 using namespace ::ONNX_NAMESPACE;
 
@@ -17,6 +20,215 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 namespace common {
+namespace {
+// The protobuf wire format, https://protobuf.dev/programming-guides/encoding
+enum WireType : uint32_t { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2, FIXED32 = 5 };
+
+// The numbers of the onnx.proto fields on the path to the raw data of the initializers
+constexpr uint32_t MODEL_GRAPH = 7;
+constexpr uint32_t GRAPH_INITIALIZER = 5;
+constexpr uint32_t TENSOR_RAW_DATA = 9;
+constexpr uint32_t TENSOR_EXTERNAL_DATA = 13;
+constexpr uint32_t TENSOR_DATA_LOCATION = 14;
+constexpr uint32_t ENTRY_KEY = 1;
+constexpr uint32_t ENTRY_VALUE = 2;
+
+// The small initializers are kept in the model: they are mostly the shapes, axes and other values which
+// are read during the conversion, and referring to them wouldn't save much memory
+constexpr uint64_t MIN_MAPPED_RAW_DATA_SIZE = 4096;
+
+struct WireField {
+    uint32_t number;
+    uint32_t wire_type;
+    const char* begin;  // the tag of the field
+    const char* value;  // the value, or the payload of the length delimited field
+    const char* end;
+};
+
+class WireReader {
+public:
+    WireReader(const char* begin, const char* end) : m_pos{begin}, m_end{end} {}
+
+    bool at_end() const {
+        return m_pos == m_end;
+    }
+
+    /// \brief Reads the next field. Returns false for the malformed message or the deprecated groups.
+    bool next(WireField& field) {
+        field.begin = m_pos;
+        uint64_t tag = 0;
+        if (!read_varint(tag)) {
+            return false;
+        }
+        field.number = static_cast<uint32_t>(tag >> 3);
+        field.wire_type = static_cast<uint32_t>(tag & 0x7);
+        field.value = m_pos;
+        switch (field.wire_type) {
+        case VARINT: {
+            uint64_t value = 0;
+            if (!read_varint(value)) {
+                return false;
+            }
+            break;
+        }
+        case FIXED64:
+        case FIXED32: {
+            const std::ptrdiff_t size = field.wire_type == FIXED64 ? 8 : 4;
+            if (m_end - m_pos < size) {
+                return false;
+            }
+            m_pos += size;
+            break;
+        }
+        case LENGTH_DELIMITED: {
+            uint64_t size = 0;
+            if (!read_varint(size) || size > static_cast<uint64_t>(m_end - m_pos)) {
+                return false;
+            }
+            field.value = m_pos;
+            m_pos += size;
+            break;
+        }
+        default:
+            return false;
+        }
+        field.end = m_pos;
+        return true;
+    }
+
+private:
+    bool read_varint(uint64_t& value) {
+        value = 0;
+        for (uint32_t shift = 0; shift < 64 && m_pos < m_end; shift += 7) {
+            const auto byte = static_cast<uint8_t>(*m_pos++);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+void write_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void write_length_delimited(std::string& out, uint32_t number, const std::string& value) {
+    write_varint(out, (static_cast<uint64_t>(number) << 3) | LENGTH_DELIMITED);
+    write_varint(out, value.size());
+    out.append(value);
+}
+
+/// \brief Copies the serialized ModelProto replacing the large raw data of the main graph initializers
+///        with the references to it in the model file.
+class MappedModelRewriter {
+public:
+    MappedModelRewriter(const char* file_begin, const std::string& location)
+        : m_file_begin{file_begin},
+          m_location{location} {}
+
+    bool rewrite_model(const char* begin, const char* end, std::string& out) const {
+        return rewrite_submessages(begin, end, MODEL_GRAPH, out, [this](const char* b, const char* e, std::string& o) {
+            return rewrite_graph(b, e, o);
+        });
+    }
+
+private:
+    template <class Rewrite>
+    static bool rewrite_submessages(const char* begin,
+                                    const char* end,
+                                    uint32_t number,
+                                    std::string& out,
+                                    const Rewrite& rewrite) {
+        WireReader reader{begin, end};
+        WireField field;
+        std::string submessage;
+        while (!reader.at_end()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.number == number && field.wire_type == LENGTH_DELIMITED) {
+                submessage.clear();
+                if (!rewrite(field.value, field.end, submessage)) {
+                    return false;
+                }
+                write_length_delimited(out, number, submessage);
+            } else {
+                out.append(field.begin, field.end);
+            }
+        }
+        return true;
+    }
+
+    bool rewrite_graph(const char* begin, const char* end, std::string& out) const {
+        return rewrite_submessages(begin,
+                                   end,
+                                   GRAPH_INITIALIZER,
+                                   out,
+                                   [this](const char* b, const char* e, std::string& o) {
+                                       return rewrite_tensor(b, e, o);
+                                   });
+    }
+
+    bool rewrite_tensor(const char* begin, const char* end, std::string& out) const {
+        WireReader reader{begin, end};
+        WireField field;
+        WireField raw_data{};
+        bool has_raw_data = false;
+        bool is_external = false;
+        while (!reader.at_end()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.number == TENSOR_RAW_DATA && field.wire_type == LENGTH_DELIMITED) {
+                // the last one wins as for any other scalar field
+                raw_data = field;
+                has_raw_data = true;
+            } else if (field.number == TENSOR_EXTERNAL_DATA || field.number == TENSOR_DATA_LOCATION) {
+                is_external = true;
+            }
+        }
+        const auto raw_data_size = has_raw_data ? static_cast<uint64_t>(raw_data.end - raw_data.value) : 0;
+        if (is_external || raw_data_size < MIN_MAPPED_RAW_DATA_SIZE) {
+            out.append(begin, end);
+            return true;
+        }
+
+        reader = WireReader{begin, end};
+        while (!reader.at_end()) {
+            reader.next(field);
+            if (field.number != TENSOR_RAW_DATA) {
+                out.append(field.begin, field.end);
+            }
+        }
+        write_external_data_entry(out, "location", m_location);
+        write_external_data_entry(out, "offset", std::to_string(raw_data.value - m_file_begin));
+        write_external_data_entry(out, "length", std::to_string(raw_data_size));
+        write_varint(out, (static_cast<uint64_t>(TENSOR_DATA_LOCATION) << 3) | VARINT);
+        write_varint(out, TensorProto_DataLocation_EXTERNAL);
+        return true;
+    }
+
+    static void write_external_data_entry(std::string& out, const std::string& key, const std::string& value) {
+        std::string entry;
+        write_length_delimited(entry, ENTRY_KEY, key);
+        write_length_delimited(entry, ENTRY_VALUE, value);
+        write_length_delimited(out, TENSOR_EXTERNAL_DATA, entry);
+    }
+
+    const char* m_file_begin;
+    const std::string m_location;
+};
+}  // namespace
+
 ModelProto parse_from_file(const std::string& file_path) {
     std::ifstream file_stream{file_path.c_str(), std::ios::in | std::ios::binary};
 
@@ -43,6 +255,75 @@ ModelProto parse_from_file(const std::wstring& file_path) {
 }
 #endif
 
+ModelProto parse_from_mapped_file(const std::string& file_path) {
+    // the location of the external data is resolved against the directory of the model
+    const auto location = ov::util::get_file_name(file_path);
+    std::shared_ptr<ov::MappedMemory> mapped_file;
+    if (!location.empty() && ov::util::sanitize_path(location) == location) {
+        try {
+            mapped_file = ov::load_mmap_object(file_path);
+        } catch (const std::exception&) {
+            mapped_file = nullptr;
+        }
+    }
+    if (!mapped_file || mapped_file->size() == 0) {
+        return parse_from_file(file_path);
+    }
+
+    const char* begin = mapped_file->data();
+    std::string model;
+    if (!MappedModelRewriter{begin, location}.rewrite_model(begin, begin + mapped_file->size(), model)) {
+        return parse_from_file(file_path);
+    }
+
+    ModelProto model_proto;
+    if (!model_proto.ParseFromString(model)) {
+        OPENVINO_THROW("Error during import of ONNX model: \"", file_path, '"');
+    }
+    return model_proto;
+}
+
+void inline_mapped_file_data(ModelProto& model_proto, const std::string& file_path) {
+    const auto location = ov::util::get_file_name(file_path);
+    std::ifstream file_stream;
+    for (auto& initializer : *model_proto.mutable_graph()->mutable_initializer()) {
+        if (initializer.data_location() != TensorProto_DataLocation_EXTERNAL) {
+            continue;
+        }
+        bool is_mapped_file = false;
+        uint64_t offset = 0;
+        uint64_t length = 0;
+        for (const auto& entry : initializer.external_data()) {
+            if (entry.key() == "location") {
+                is_mapped_file = entry.value() == location;
+            } else if (entry.key() == "offset") {
+                offset = std::stoull(entry.value());
+            } else if (entry.key() == "length") {
+                length = std::stoull(entry.value());
+            }
+        }
+        if (!is_mapped_file) {
+            continue;
+        }
+        if (!file_stream.is_open()) {
+            file_stream.open(file_path, std::ios::in | std::ios::binary);
+            OPENVINO_ASSERT(file_stream.is_open(), "Could not open the file: \"", file_path, '"');
+        }
+        std::string raw_data(length, '\0');
+        file_stream.seekg(static_cast<std::streamoff>(offset));
+        file_stream.read(&raw_data[0], static_cast<std::streamsize>(length));
+        OPENVINO_ASSERT(file_stream.good(),
+                        "Could not read the data of the initializer '",
+                        initializer.name(),
+                        "' from the file: \"",
+                        file_path,
+                        '"');
+        initializer.clear_external_data();
+        initializer.clear_data_location();
+        initializer.set_raw_data(std::move(raw_data));
+    }
+}
+
 ModelProto parse_from_istream(std::istream& model_stream) {
     if (!model_stream.good()) {
         model_stream.clear();
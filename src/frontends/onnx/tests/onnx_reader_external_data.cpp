@@ -6,14 +6,18 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdio>
 #include <fstream>
+#include <numeric>
 #include <set>
 #include <streambuf>
 #include <string>
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/unicode_utils.hpp"
+#include "onnx_common/parser.hpp"
 #include "onnx_utils.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/frontend/manager.hpp"
@@ -407,4 +411,81 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_from_ORT_MEM_ADDR) {
     test_case.run();
 }
 
+namespace {
+// The initializer is large enough to be referred to in the mapped model file instead of being copied
+ModelProto make_embedded_initializer_model(const std::vector<float>& weights) {
+    const auto size = static_cast<int64_t>(weights.size());
+    ModelProto model_proto;
+    model_proto.set_ir_version(::ONNX_NAMESPACE::IR_VERSION);
+    model_proto.add_opset_import()->set_version(13);
+    auto* graph = model_proto.mutable_graph();
+    graph->set_name("embedded_initializer");
+    auto* initializer = graph->add_initializer();
+    initializer->set_name("W");
+    initializer->set_data_type(::ONNX_NAMESPACE::TensorProto::FLOAT);
+    initializer->add_dims(size);
+    initializer->set_raw_data(weights.data(), weights.size() * sizeof(float));
+    auto* node = graph->add_node();
+    node->set_op_type("Add");
+    node->add_input("X");
+    node->add_input("W");
+    node->add_output("Y");
+    const auto set_value_info = [size](::ONNX_NAMESPACE::ValueInfoProto* value_info, const std::string& name) {
+        value_info->set_name(name);
+        auto* tensor_type = value_info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(::ONNX_NAMESPACE::TensorProto::FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(size);
+    };
+    set_value_info(graph->add_input(), "X");
+    set_value_info(graph->add_output(), "Y");
+    return model_proto;
+}
+
+std::string save_model(const ModelProto& model_proto) {
+    const auto path = test::utils::generateTestFilePrefix() + "_embedded_initializer.onnx";
+    std::ofstream file{path, ios::out | ios::binary};
+    model_proto.SerializeToOstream(&file);
+    return path;
+}
+}  // namespace
+
+TEST_P(OnnxFeMmapFixture, onnx_embedded_initializer_read_from_mapped_file) {
+    const size_t size = 1024;
+    std::vector<float> weights(size);
+    std::iota(weights.begin(), weights.end(), 0.f);
+    const auto path = save_model(make_embedded_initializer_model(weights));
+
+    std::vector<float> expected(size);
+    std::transform(weights.begin(), weights.end(), expected.begin(), [](float w) {
+        return w + 1.f;
+    });
+    {
+        // the model holds the mapping of the file
+        Core core;
+        core.set_property(enable_mmap(GetParam()));
+        const auto model = core.read_model(path);
+        auto test_case = test::TestCase(model);
+        test_case.add_input<float>(std::vector<float>(size, 1.f));
+        test_case.add_expected_output<float>(Shape{size}, expected);
+        test_case.run();
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OnnxFeMmap, onnx_embedded_initializer_inlined_for_serialization) {
+    std::vector<float> weights(1024);
+    std::iota(weights.begin(), weights.end(), 0.f);
+    const auto model_proto = make_embedded_initializer_model(weights);
+    const auto path = save_model(model_proto);
+
+    auto mapped_model_proto = frontend::onnx::common::parse_from_mapped_file(path);
+    const auto& initializer = mapped_model_proto.graph().initializer(0);
+    EXPECT_EQ(initializer.data_location(), ::ONNX_NAMESPACE::TensorProto::EXTERNAL);
+    EXPECT_FALSE(initializer.has_raw_data());
+
+    frontend::onnx::common::inline_mapped_file_data(mapped_model_proto, path);
+    EXPECT_EQ(mapped_model_proto.SerializeAsString(), model_proto.SerializeAsString());
+    std::remove(path.c_str());
+}
+
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <functional>
+#include <ostream>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -37,6 +40,20 @@ static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> cac
  */
 static constexpr Property<bool, PropertyMutability::RO> caching_with_mmap{"CACHING_WITH_MMAP"};
 
+/**
+ * @brief Rewrites the model cache entry of a compiled model with the blob produced by the given export function
+ * @ingroup ov_dev_api_plugin_api
+ */
+using CacheWriter = std::function<void(const std::function<void(std::ostream&)>&)>;
+
+/**
+ * @brief Write-only property of the compiled model, set by the core once the compiled model is written to the model
+ * cache if the plugin lists it in ov::internal::supported_properties. The compiled model may use the writer later to
+ * update its cache entry, e.g. with the data collected by the inferences.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<CacheWriter, PropertyMutability::WO> cache_writer{"CACHE_WRITER"};
+
 /**
  * @brief Allow to create exclusive_async_requests with one executor
  * @ingroup ov_dev_api_plugin_api
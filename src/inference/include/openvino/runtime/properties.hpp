@@ -876,6 +876,15 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the target latency (in ms) of the requests executed via the auto-batching.
+ * A non-zero value enables the adaptive batching: the batch is executed as soon as waiting for more requests may
+ * violate the target, so the batch size follows the queue depth and the measured latency of the batched execution.
+ * The default value 0 keeps the batch of the fixed size collected within the auto_batch_timeout.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -909,6 +918,20 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to enable the sharing of identical weights between the models of the same ov::Core.
+ * Disabled by default.
+ * The Core shares the data of the identical constants of the read models, and the CPU plugin shares the repacked
+ * weights of the compiled models. The weights are identified by their content, so the property increases the model
+ * reading and compilation time by the hashing of the weights.
+ *
+ * value type: boolean
+ *   - True enable the sharing of the identical weights
+ *   - False keep the weights of every model separate
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_weights_deduplication{"ENABLE_WEIGHTS_DEDUPLICATION"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -9,10 +9,13 @@
  */
 #pragma once
 
+#include <filesystem>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
+#include <system_error>
+#include <tuple>
 
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -128,8 +131,27 @@ private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
         // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
         ScopedLocale plocal_C(LC_ALL, "C");
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // the blob is replaced at once, so an entry rewritten by its compiled model doesn't change the data of the
+        // models imported from the mapped previous blob
+        const auto blob_file_name = getBlobFile(id);
+        auto temp_file_name = blob_file_name;
+        temp_file_name += ".tmp";
+        std::error_code error;
+        {
+            std::ofstream stream(temp_file_name, std::ios_base::binary | std::ofstream::out);
+            try {
+                writer(stream);
+            } catch (...) {
+                stream.close();
+                std::ignore = std::filesystem::remove(temp_file_name, error);
+                throw;
+            }
+        }
+        std::filesystem::rename(temp_file_name, blob_file_name, error);
+        if (error) {
+            // e.g. the blob is mapped on Windows, the previous blob stays valid
+            std::ignore = std::filesystem::remove(temp_file_name, error);
+        }
     }
 
     void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
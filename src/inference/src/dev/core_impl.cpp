@@ -204,8 +204,10 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
     }
 }
 
-static const auto core_properties_names =
-    ov::util::make_array(ov::cache_dir.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name());
+static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
+                                                               ov::enable_mmap.name(),
+                                                               ov::enable_weights_deduplication.name(),
+                                                               ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
     ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
@@ -906,8 +908,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         compiled_model =
             load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
-                const auto model =
-                    util::read_model(model_path, "", get_extensions_copy(), parsed._core_config.get_enable_mmap());
+                const auto model = deduplicate_weights(
+                    util::read_model(model_path, "", get_extensions_copy(), parsed._core_config.get_enable_mmap()),
+                    parsed._core_config);
                 return compile_model_and_cache(plugin, model, parsed._config, {}, cacheContent);
             });
     } else {
@@ -1247,6 +1250,9 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::enable_weights_deduplication.name()) {
+        const auto flag = coreConfig.get_enable_weights_deduplication();
+        return decltype(ov::enable_weights_deduplication)::value_type(flag);
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1366,9 +1372,8 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
                 config.erase(it);
             }
 
-            it = config.find(ov::enable_mmap.name());
-            if (it != config.end()) {
-                config.erase(it);
+            for (const auto& name : {ov::enable_mmap.name(), ov::enable_weights_deduplication.name()}) {
+                config.erase(name);
             }
         }
 
@@ -1501,12 +1506,25 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin&
                 compiled_model_runtime_properties =
                     plugin.get_property(ov::internal::compiled_model_runtime_properties.name(), {}).as<std::string>();
             }
-            cacheContent.cacheManager->write_cache_entry(cacheContent.blobId, [&](std::ostream& networkStream) {
-                networkStream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
-                                                        ov::ModelCache::calculate_file_info(cacheContent.modelPath),
-                                                        compiled_model_runtime_properties);
+            const auto file_info = ov::ModelCache::calculate_file_info(cacheContent.modelPath);
+            ov::internal::CacheWriter cache_writer =
+                [cache_manager = cacheContent.cacheManager,
+                 blob_id = cacheContent.blobId,
+                 file_info,
+                 compiled_model_runtime_properties](const std::function<void(std::ostream&)>& export_model) {
+                    cache_manager->write_cache_entry(blob_id, [&](std::ostream& networkStream) {
+                        networkStream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
+                                                                file_info,
+                                                                compiled_model_runtime_properties);
+                        export_model(networkStream);
+                    });
+                };
+            cache_writer([&](std::ostream& networkStream) {
                 compiled_model->export_model(networkStream);
             });
+            if (device_supports_internal_property(plugin, ov::internal::cache_writer.name())) {
+                compiled_model->set_property({{ov::internal::cache_writer.name(), std::move(cache_writer)}});
+            }
         } catch (...) {
             cacheContent.cacheManager->remove_cache_entry(cacheContent.blobId);
             throw;
@@ -1659,6 +1677,7 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         _cacheConfigPerDevice = other._cacheConfigPerDevice;
     }
     _flag_enable_mmap = other._flag_enable_mmap;
+    _flag_enable_weights_deduplication = other._flag_enable_weights_deduplication;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config) {
@@ -1684,6 +1703,11 @@ void ov::CoreConfig::set(const ov::AnyMap& config) {
         auto flag = it->second.as<bool>();
         _flag_enable_mmap = flag;
     }
+
+    it = config.find(ov::enable_weights_deduplication.name());
+    if (it != config.end()) {
+        _flag_enable_weights_deduplication = it->second.as<bool>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config) {
@@ -1698,7 +1722,8 @@ void ov::CoreConfig::remove_core(ov::AnyMap& config) {
 }
 
 void ov::CoreConfig::remove_core_skip_cache_dir(ov::AnyMap& config) {
-    for (const auto& name : {ov::enable_mmap.name(), ov::force_tbb_terminate.name()}) {
+    for (const auto& name :
+         {ov::enable_mmap.name(), ov::enable_weights_deduplication.name(), ov::force_tbb_terminate.name()}) {
         config.erase(name);
     }
 }
@@ -1717,6 +1742,10 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_enable_weights_deduplication() const {
+    return _flag_enable_weights_deduplication;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin,
@@ -1778,20 +1807,31 @@ std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& modelPath
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::read_model from file");
     auto local_core_config = coreConfig;
     local_core_config.set(properties);
-    return ov::util::read_model(modelPath, binPath, get_extensions_copy(), local_core_config.get_enable_mmap());
+    return deduplicate_weights(
+        ov::util::read_model(modelPath, binPath, get_extensions_copy(), local_core_config.get_enable_mmap()),
+        local_core_config);
 }
 
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
                                                     const ov::Tensor& weights,
                                                     bool frontendMode) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::read_model from memory");
-    return ov::util::read_model(model, weights, get_extensions_copy(), frontendMode);
+    return deduplicate_weights(ov::util::read_model(model, weights, get_extensions_copy(), frontendMode), coreConfig);
 }
 
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::shared_ptr<AlignedBuffer>& model,
                                                     const std::shared_ptr<AlignedBuffer>& weights) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::read_model from memory");
-    return ov::util::read_model(model, weights, get_extensions_copy());
+    return deduplicate_weights(ov::util::read_model(model, weights, get_extensions_copy()), coreConfig);
+}
+
+std::shared_ptr<ov::Model> ov::CoreImpl::deduplicate_weights(std::shared_ptr<ov::Model> model,
+                                                             const CoreConfig& config) const {
+    if (model && config.get_enable_weights_deduplication()) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::deduplicate_weights");
+        weightsStore.deduplicate(model);
+    }
+    return model;
 }
 
 std::map<std::string, ov::Version> ov::CoreImpl::get_versions(const std::string& deviceName) const {
@@ -14,6 +14,7 @@
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
+#include "weights_store.hpp"
 
 namespace ov {
 
@@ -50,6 +51,8 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_enable_weights_deduplication() const;
+
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
 
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
@@ -64,6 +67,7 @@ private:
     CacheConfig _cacheConfig;
     std::map<std::string, CacheConfig> _cacheConfigPerDevice;
     bool _flag_enable_mmap = true;
+    bool _flag_enable_weights_deduplication = false;
 };
 
 struct Parsed {
@@ -172,6 +176,11 @@ private:
 
     mutable ov::CacheGuard cacheGuard;
 
+    // shares the identical constants of the read models, see ov::enable_weights_deduplication
+    mutable ov::WeightsStore weightsStore;
+
+    std::shared_ptr<ov::Model> deduplicate_weights(std::shared_ptr<ov::Model> model, const CoreConfig& config) const;
+
     struct PluginDescriptor {
         ov::util::Path libraryLocation;
         ov::AnyMap defaultConfig;
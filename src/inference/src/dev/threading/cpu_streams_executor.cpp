@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -353,6 +354,14 @@ struct CPUStreamsExecutor::Impl {
         std::mutex _stream_map_mutex;
     };
 
+    // the task queue of the stream thread, other stream threads steal from it when their own queues are empty
+    struct WorkerQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        // NUMA node of the stream which serves the queue, it is known once the stream executes the first task
+        std::atomic<int> _numaNodeId{-1};
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams(
@@ -371,6 +380,10 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        _workerQueues.reserve(streams_num);
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _workerQueues.emplace_back(std::make_unique<WorkerQueue>());
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -378,20 +391,23 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                auto& queue = *_workerQueues[streamId];
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    if (Pop(streamId, task)) {
+                        auto& stream = *(_streams.local());
+                        queue._numaNodeId.store(stream._numaNodeId, std::memory_order_relaxed);
+                        Execute(task, stream);
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _sleepingWorkers.fetch_add(1);
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || _isStopped;
+                    });
+                    _sleepingWorkers.fetch_sub(1);
+                    if (_isStopped && _pendingTasks.load() == 0) {
+                        break;
                     }
                 }
             });
@@ -400,11 +416,56 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        // spread the submissions between the per stream queues to avoid contention on a single lock
+        auto& queue = *_workerQueues[_nextQueue.fetch_add(1, std::memory_order_relaxed) % _workerQueues.size()];
+        _pendingTasks.fetch_add(1);
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        if (_sleepingWorkers.load() > 0) {
+            {
+                // synchronize with a worker which is going to sleep to avoid a lost wake-up
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryPop(WorkerQueue& queue, Task& task) {
+        std::lock_guard<std::mutex> lock(queue._mutex);
+        if (queue._tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        _pendingTasks.fetch_sub(1);
+        return true;
+    }
+
+    /**
+     * Takes a task from the own queue of the worker first. If it is empty, steals a task from the queues of the
+     * workers on the same NUMA node and only then from the rest of the queues.
+     */
+    bool Pop(const int workerId, Task& task) {
+        if (TryPop(*_workerQueues[workerId], task)) {
+            return true;
+        }
+        if (_pendingTasks.load() == 0) {
+            return false;
+        }
+        const auto numaNodeId = _workerQueues[workerId]->_numaNodeId.load(std::memory_order_relaxed);
+        const auto queuesNum = _workerQueues.size();
+        for (bool sameNumaNode : {true, false}) {
+            for (size_t i = 1; i < queuesNum; ++i) {
+                auto& victim = *_workerQueues[(workerId + i) % queuesNum];
+                const bool isSameNumaNode = victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId;
+                if (isSameNumaNode == sameNumaNode && TryPop(victim, task)) {
+                    return true;
+                }
+            }
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -472,9 +533,13 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<size_t> _pendingTasks{0};
+    std::atomic<int> _sleepingWorkers{0};
+    // guards the sleep and the wake-up of the idle stream threads
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_store.hpp"
+
+#include <cstring>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+
+namespace ov {
+
+namespace {
+// the small constants are not worth the hashing, they take a small part of the weights anyway
+constexpr size_t min_byte_size = 4096;
+}  // namespace
+
+void WeightsStore::deduplicate(const std::shared_ptr<ov::Model>& model) {
+    {
+        // forget the data of the released models
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_buffers.begin(); it != m_buffers.end();) {
+            it = it->second.expired() ? m_buffers.erase(it) : std::next(it);
+        }
+    }
+
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto multi_subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : multi_subgraph->get_functions()) {
+                deduplicate(body);
+            }
+            continue;
+        }
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant || constant->get_element_type() == ov::element::string ||
+            constant->get_byte_size() < min_byte_size) {
+            continue;
+        }
+        const auto buffer = find_or_add(constant);
+        if (!buffer) {
+            // the data are already shared
+            continue;
+        }
+        auto shared =
+            std::make_shared<ov::op::v0::Constant>(constant->get_element_type(), constant->get_shape(), buffer);
+        shared->set_friendly_name(constant->get_friendly_name());
+        shared->get_rt_info() = constant->get_rt_info();
+        ov::replace_node(constant, shared);
+    }
+}
+
+std::shared_ptr<ov::AlignedBuffer> WeightsStore::find_or_add(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+    const auto size = constant->get_byte_size();
+    const auto* data = constant->get_data_ptr();
+    const auto hash = ov::runtime::compute_hash(data, size);
+
+    // the candidates are compared without the lock, so the models read concurrently don't wait for each other
+    std::vector<std::shared_ptr<ov::AlignedBuffer>> candidates;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_buffers.equal_range(hash);
+        for (auto it = found.first; it != found.second; ++it) {
+            if (auto stored = it->second.lock()) {
+                if (stored->size() == size) {
+                    candidates.push_back(std::move(stored));
+                }
+            }
+        }
+    }
+    for (auto& stored : candidates) {
+        if (stored->get_ptr() == data) {
+            return nullptr;
+        }
+        if (std::memcmp(stored->get_ptr(), data, size) == 0) {
+            return std::move(stored);
+        }
+    }
+
+    // the buffer keeps the data owner alive, the constant itself is replaced by the one referring to the buffer
+    std::shared_ptr<ov::AlignedBuffer> buffer =
+        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::op::v0::Constant>>>(
+            const_cast<char*>(static_cast<const char*>(data)),
+            size,
+            constant);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.emplace(hash, buffer);
+    return buffer;
+}
+
+}  // namespace ov
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the OpenVINO Weights Store class
+ *
+ * @file weights_store.hpp
+ */
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov {
+
+/**
+ * @brief This class deduplicates the constant data of the models read by the same Core
+ * The data are identified by their content: the hash of the data is looked up first and the candidates are compared
+ * byte-wise, so the identical constants of the different models (e.g. the base model and its fine-tuned variants)
+ * end up sharing the data of the constant seen first.
+ * The store tracks the data buffers rather than the constants: all the constants with the stored data (including the
+ * first one) are made to refer to the same buffer, so the data are found as long as any model or plugin keeps the
+ * buffer, even if the constant seen first has been replaced or released. The store keeps only weak references, the
+ * shared data are owned by the constants which use them.
+ *
+ * Usage example:
+ *     WeightsStore store;
+ *     auto model = <read model>;
+ *     store.deduplicate(model);
+ */
+class WeightsStore {
+public:
+    WeightsStore() = default;
+
+    /**
+     * @brief Replaces the constants of the model (including the ones of the sub-graphs) with the constants sharing the
+     * identical data already known to the store, the data of the other constants are added to the store
+     * @note Small constants and the string constants are left as is
+     *
+     * @param model The model to process
+     */
+    void deduplicate(const std::shared_ptr<ov::Model>& model);
+
+private:
+    /**
+     * @brief Returns the stored buffer with the same data as the given constant, or adds the buffer of the constant
+     * data if they are seen first
+     */
+    std::shared_ptr<ov::AlignedBuffer> find_or_add(const std::shared_ptr<ov::op::v0::Constant>& constant);
+
+    std::mutex m_mutex;
+    // the hash of the data -> the buffer of the data
+    std::unordered_multimap<size_t, std::weak_ptr<ov::AlignedBuffer>> m_buffers;
+};
+
+}  // namespace ov
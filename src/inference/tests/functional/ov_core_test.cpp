@@ -5,11 +5,16 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <map>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/unicode_utils.hpp"
 #include "functional_test_utils/test_model/test_model.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/util/file_util.hpp"
 
@@ -207,4 +212,87 @@ TEST_F(CoreBaseTest, compile_model_with_std_fs_path) {
     }
 #endif
 }
+
+TEST_F(CoreBaseTest, read_model_with_weights_deduplication) {
+    const auto prefix = ov::test::utils::generateTestFilePrefix();
+    model_file_name = prefix + "_dedup.xml";
+    weight_file_name = prefix + "_dedup.bin";
+    const auto variant_model_name = prefix + "_dedup_variant.xml";
+    const auto variant_weight_name = prefix + "_dedup_variant.bin";
+    // the variant shares the first weights with the model and has its own second weights
+    auto make_model = [](float second_value) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4096});
+        auto first = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4096}, std::vector<float>(4096, 1.f));
+        auto second =
+            ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4096}, std::vector<float>(4096, second_value));
+        first->set_friendly_name("first");
+        second->set_friendly_name("second");
+        auto add = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v1::Add>(param, first), second);
+        return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+    };
+    ov::serialize(make_model(2.f), model_file_name, weight_file_name);
+    ov::serialize(make_model(3.f), variant_model_name, variant_weight_name);
+
+    auto get_constants = [](const std::shared_ptr<ov::Model>& model) {
+        std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> constants;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+                constants[constant->get_friendly_name()] = constant;
+            }
+        }
+        return constants;
+    };
+
+    for (const auto enabled : {false, true}) {
+        ov::Core core;
+        core.set_property(ov::enable_weights_deduplication(enabled));
+        EXPECT_EQ(core.get_property(ov::enable_weights_deduplication), enabled);
+
+        const auto model = core.read_model(model_file_name);
+        const auto variant = core.read_model(variant_model_name);
+        const auto constants = get_constants(model);
+        const auto variant_constants = get_constants(variant);
+        ASSERT_EQ(constants.size(), 2);
+        ASSERT_EQ(variant_constants.size(), 2);
+
+        EXPECT_EQ(constants.at("first")->get_data_ptr() == variant_constants.at("first")->get_data_ptr(), enabled);
+        EXPECT_NE(constants.at("second")->get_data_ptr(), variant_constants.at("second")->get_data_ptr());
+        EXPECT_EQ(variant_constants.at("first")->get_vector<float>(), std::vector<float>(4096, 1.f));
+        EXPECT_EQ(variant_constants.at("second")->get_vector<float>(), std::vector<float>(4096, 3.f));
+    }
+    ov::test::utils::removeIRFiles(variant_model_name, variant_weight_name);
+}
+
+TEST_F(CoreBaseTest, read_model_with_weights_deduplication_after_model_release) {
+    const auto prefix = ov::test::utils::generateTestFilePrefix();
+    model_file_name = prefix + "_dedup_release.xml";
+    weight_file_name = prefix + "_dedup_release.bin";
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4096});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4096}, std::vector<float>(4096, 1.f));
+    auto add = std::make_shared<ov::op::v1::Add>(param, weights);
+    ov::serialize(std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param}),
+                  model_file_name,
+                  weight_file_name);
+
+    ov::Core core;
+    core.set_property(ov::enable_weights_deduplication(true));
+    std::shared_ptr<ov::Node> copy;
+    {
+        // only a copy of the constant keeps the data, like the constants of a compiled model
+        const auto model = core.read_model(model_file_name);
+        for (const auto& op : model->get_ordered_ops()) {
+            if (ov::is_type<ov::op::v0::Constant>(op)) {
+                copy = op->clone_with_new_inputs({});
+            }
+        }
+    }
+    ASSERT_NE(copy, nullptr);
+
+    const auto model = core.read_model(model_file_name);
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            EXPECT_EQ(constant->get_data_ptr(), ov::as_type_ptr<ov::op::v0::Constant>(copy)->get_data_ptr());
+        }
+    }
+}
 }  // namespace ov::test
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <future>
 #include <thread>
 
@@ -263,3 +265,35 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+// The tasks are spread over the queues of the streams, so the ones queued to a busy stream have to be stolen by the idle
+// one
+TEST(CPUStreamsExecutorTests, idleStreamRunsTasksQueuedToBusyStream) {
+    constexpr int NUM_TASKS = 16;
+    auto taskExecutor =
+        std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+
+    std::promise<void> blockerStarted;
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    auto blocker = async(taskExecutor, [&] {
+        blockerStarted.set_value();
+        unblocked.wait();
+    });
+    blockerStarted.get_future().wait();
+
+    std::atomic_int done = {0};
+    std::promise<void> allDone;
+    for (int i = 0; i < NUM_TASKS; i++) {
+        taskExecutor->run([&] {
+            if (++done == NUM_TASKS) {
+                allDone.set_value();
+            }
+        });
+    }
+    const auto status = allDone.get_future().wait_for(std::chrono::seconds(30));
+    unblock.set_value();
+    blocker.wait();
+    ASSERT_EQ(std::future_status::ready, status);
+    ASSERT_EQ(NUM_TASKS, done);
+}
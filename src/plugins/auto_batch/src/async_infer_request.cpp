@@ -65,6 +65,17 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                if (workerInferRequest->_policy) {
+                    // adaptive batching decides on every arrival
+                    _this->m_sync_request->m_arrival_time = BatchingPolicy::Clock::now();
+                    workerInferRequest->_tasks.push(t);
+                    {
+                        std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                        workerInferRequest->_is_wakeup = true;
+                    }
+                    workerInferRequest->_cond.notify_one();
+                    return;
+                }
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
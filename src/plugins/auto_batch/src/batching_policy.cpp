@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batching_policy.hpp"
+
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+namespace {
+// the smoothing factors of the mean and the deviation, the same as for the TCP round-trip time (RFC 6298)
+constexpr double mean_gain = 1.0 / 8;
+constexpr double deviation_gain = 1.0 / 4;
+constexpr double deviation_factor = 4.0;
+}  // namespace
+
+BatchingPolicy::BatchingPolicy(size_t max_batch_size, std::chrono::milliseconds latency_slo)
+    : m_estimates(max_batch_size),
+      m_latency_slo(latency_slo) {
+    OPENVINO_ASSERT(max_batch_size > 0, "The batch size of the adaptive batching must be positive");
+}
+
+void BatchingPolicy::update(size_t batch_size, Clock::duration latency) {
+    OPENVINO_ASSERT(batch_size > 0 && batch_size <= m_estimates.size(), "Unexpected batch size ", batch_size);
+    auto& estimate = m_estimates[batch_size - 1];
+    const auto sample = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+    if (!estimate.measured) {
+        estimate.mean = sample;
+        estimate.deviation = sample / 2;
+        estimate.measured = true;
+    } else {
+        estimate.deviation += deviation_gain * (std::abs(sample - estimate.mean) - estimate.deviation);
+        estimate.mean += mean_gain * (sample - estimate.mean);
+    }
+    m_measured = true;
+}
+
+BatchingPolicy::Clock::duration BatchingPolicy::predict(size_t batch_size) const {
+    OPENVINO_ASSERT(batch_size > 0 && batch_size <= m_estimates.size(), "Unexpected batch size ", batch_size);
+    if (!m_measured)
+        return Clock::duration::zero();
+    auto to_duration = [](const Estimate& estimate, double scale) {
+        const auto ns = (estimate.mean + deviation_factor * estimate.deviation) * scale;
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(static_cast<int64_t>(ns)));
+    };
+    // the latency does not decrease with the batch size, so the closest larger batch gives the upper bound
+    for (size_t i = batch_size - 1; i < m_estimates.size(); i++) {
+        if (m_estimates[i].measured)
+            return to_duration(m_estimates[i], 1.0);
+    }
+    // otherwise extrapolate the largest measured batch linearly (i.e. no gain from the batching is expected)
+    for (size_t i = batch_size - 1; i > 0; i--) {
+        if (m_estimates[i - 1].measured)
+            return to_duration(m_estimates[i - 1], static_cast<double>(batch_size) / static_cast<double>(i));
+    }
+    return Clock::duration::zero();
+}
+
+BatchingPolicy::Clock::time_point BatchingPolicy::deadline(Clock::time_point oldest_arrival, size_t batch_size) const {
+    if (!m_measured)
+        return oldest_arrival;
+    const auto latency = predict(batch_size);
+    if (latency >= m_latency_slo)
+        return oldest_arrival;
+    return oldest_arrival + (m_latency_slo - latency);
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
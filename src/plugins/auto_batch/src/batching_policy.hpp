@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Decides when the collected requests are executed in the adaptive batching mode.
+ * The latency of the batched execution is tracked per batch size (the smoothed mean and the mean deviation, as for the
+ * TCP round-trip time), so the batch is launched at the last moment that still meets the latency target of the
+ * oldest collected request.
+ * @note The class is not thread safe, it is used by the single worker thread of the batched request.
+ */
+class BatchingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    BatchingPolicy(size_t max_batch_size, std::chrono::milliseconds latency_slo);
+
+    /**
+     * @brief Accounts the measured latency of the batch execution
+     * @param batch_size the number of the requests executed in the batch
+     * @param latency the time from the batch launch to its completion
+     */
+    void update(size_t batch_size, Clock::duration latency);
+
+    /**
+     * @brief Predicts the pessimistic (mean + 4 deviations) latency of the batch execution
+     * The sizes which were not measured yet are estimated with the closest measured ones.
+     * @return the predicted latency, zero if no batch was measured so far
+     */
+    Clock::duration predict(size_t batch_size) const;
+
+    /**
+     * @brief Returns the latest launch time of the batch that still meets the latency target
+     * @param oldest_arrival the time of the arrival of the oldest request in the batch
+     * @param batch_size the size of the batch to launch
+     * @note Until the first measurement the batch is due immediately
+     */
+    Clock::time_point deadline(Clock::time_point oldest_arrival, size_t batch_size) const;
+
+    size_t get_max_batch_size() const {
+        return m_estimates.size();
+    }
+
+private:
+    struct Estimate {
+        double mean = 0.0;       // ns
+        double deviation = 0.0;  // ns
+        bool measured = false;
+    };
+
+    std::vector<Estimate> m_estimates;  // indexed by the batch size - 1
+    Clock::duration m_latency_slo;
+    bool m_measured = false;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -6,6 +6,7 @@
 #include "compiled_model.hpp"
 
 #include "async_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
@@ -29,12 +30,26 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_slo = config.find(ov::auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = latency_slo->second.as<std::uint32_t>();
 }
 
 CompiledModel::~CompiledModel() {
     m_terminate = true;
     for (const auto& w : m_worker_requests) {
+        {
+            // wake the worker up instead of letting it sleep till the timeout
+            std::lock_guard<std::mutex> lock(w->_mutex);
+            w->_is_wakeup = true;
+        }
+        w->_cond.notify_one();
         w->_thread.join();
+        // the callback of the batch in flight still uses the worker
+        std::unique_lock<std::mutex> lock(w->_mutex);
+        w->_cond.wait(lock, [&w] {
+            return !w->_batch_in_flight;
+        });
     }
     m_worker_requests.clear();
 }
@@ -65,14 +80,43 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        if (m_latency_slo) {
+            workerRequestPtr->_policy = std::make_unique<BatchingPolicy>(workerRequestPtr->_batch_size,
+                                                                         std::chrono::milliseconds(m_latency_slo));
+            const auto& inputs = m_compiled_model_with_batch->inputs();
+            for (const auto& input_id : m_batched_inputs) {
+                const auto& input = inputs[input_id];
+                auto shape = input.get_partial_shape();
+                if (shape[0].is_static())
+                    continue;
+                workerRequestPtr->_dynamic_batch = true;
+                shape[0] = workerRequestPtr->_batch_size;
+                workerRequestPtr->_batched_tensors.emplace_back(
+                    input,
+                    ov::SoPtr<ov::ITensor>{ov::make_tensor(input.get_element_type(), shape.to_shape()), nullptr});
+            }
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
-                OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
+                OPENVINO_ASSERT(workerRequestPtr->_policy ||
+                                workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
-                    workerRequestPtr->_completion_tasks[c]();
+                for (auto& task : workerRequestPtr->_completion_tasks) {
+                    task();
+                }
+                if (workerRequestPtr->_policy) {
+                    // the policy is updated by the worker thread, which collects the next batch meanwhile
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                    workerRequestPtr->_batch_duration =
+                        BatchingPolicy::Clock::now() - workerRequestPtr->_batch_start;
+                    workerRequestPtr->_batch_in_flight = false;
+                    workerRequestPtr->_batch_completed = true;
+                    workerRequestPtr->_is_wakeup = true;
+                    // notified under the mutex, so the worker can't be destroyed before the notification
+                    workerRequestPtr->_cond.notify_one();
+                    return;
                 }
                 // reset the timeout
                 workerRequestPtr->_is_wakeup = true;
@@ -80,6 +124,8 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            if (workerRequestPtr->_policy)
+                return run_adaptive_batching(*workerRequestPtr);
             while (1) {
                 std::cv_status status;
                 {
@@ -135,9 +181,109 @@ CompiledModel::GetWorkerInferRequest() const {
             }
         });
     }
+    m_worker_requests.back()->_num_requests++;
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::run_adaptive_batching(WorkerInferRequest& worker) const {
+    using Clock = BatchingPolicy::Clock;
+    const auto max_batch_size = static_cast<size_t>(worker._batch_size);
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> pending;
+    while (!m_terminate) {
+        // the static batch costs the same regardless of the number of the collected requests
+        auto batch_size_to_predict = [&] {
+            return worker._dynamic_batch ? std::min(pending.size() + 1, max_batch_size) : max_batch_size;
+        };
+        bool in_flight = false;
+        bool completed = false;
+        size_t completed_rows = 0;
+        Clock::duration completed_duration{0};
+        {
+            std::unique_lock<std::mutex> lock(worker._mutex);
+            auto wake_up = Clock::now() + std::chrono::milliseconds(m_latency_slo);
+            // the requests collected while the batched request is busy wait for its completion
+            if (!pending.empty() && !worker._batch_in_flight) {
+                const auto deadline = worker._policy->deadline(pending.front().first->m_sync_request->m_arrival_time,
+                                                               batch_size_to_predict());
+                wake_up = std::min(wake_up, deadline);
+            }
+            worker._cond.wait_until(lock, wake_up, [&worker] {
+                return worker._is_wakeup;
+            });
+            worker._is_wakeup = false;
+            in_flight = worker._batch_in_flight;
+            std::swap(completed, worker._batch_completed);
+            completed_rows = worker._batch_rows;
+            completed_duration = worker._batch_duration;
+        }
+        if (completed)
+            worker._policy->update(completed_rows, completed_duration);
+        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+        while (worker._tasks.try_pop(t)) {
+            pending.push_back(std::move(t));
+        }
+        if (in_flight || pending.empty())
+            continue;
+        const auto num = std::min(pending.size(), max_batch_size);
+        // no more requests can arrive when all the requests of the worker are collected
+        const bool full = num == max_batch_size || pending.size() >= static_cast<size_t>(worker._num_requests);
+        if (!full && Clock::now() < worker._policy->deadline(pending.front().first->m_sync_request->m_arrival_time,
+                                                             batch_size_to_predict()))
+            continue;
+        launch_batch(worker, pending, num);
+    }
+}
+
+void CompiledModel::launch_batch(
+    WorkerInferRequest& worker,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks,
+    size_t num) const {
+    using Clock = BatchingPolicy::Clock;
+    const auto rows = worker._dynamic_batch ? num : static_cast<size_t>(worker._batch_size);
+    for (const auto& batched : worker._batched_tensors) {
+        auto shape = batched.second->get_shape();
+        shape[0] = rows;
+        worker._infer_request_batched->set_tensor(
+            batched.first,
+            {ov::make_tensor(batched.second->get_element_type(), shape, batched.second->data()), batched.second._so});
+    }
+    worker._completion_tasks.clear();
+    std::vector<ov::autobatch_plugin::AsyncInferRequest*> requests;
+    requests.reserve(num);
+    for (size_t n = 0; n < num; n++) {
+        requests.push_back(tasks[n].first);
+        auto& sync_request = tasks[n].first->m_sync_request;
+        // the rows of the static batch are owned by the requests, the dynamic batch is packed densely
+        if (worker._dynamic_batch)
+            sync_request->set_batch_position(n, rows);
+        sync_request->copy_inputs_if_needed();
+        sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+        worker._completion_tasks.push_back(std::move(tasks[n].second));
+    }
+    tasks.erase(tasks.begin(), tasks.begin() + num);
+
+    {
+        // the completion is reported by the callback of the batched request, the worker doesn't wait for it
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        worker._batch_in_flight = true;
+        worker._batch_rows = rows;
+        worker._batch_start = Clock::now();
+    }
+    try {
+        worker._infer_request_batched->start_async();
+    } catch (...) {
+        // the callback of the batched request is not called, so the requests of the batch are failed here
+        const auto exception = std::current_exception();
+        for (auto* request : requests)
+            request->m_sync_request->m_exception_ptr = exception;
+        for (auto& task : worker._completion_tasks)
+            task();
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        worker._batch_in_flight = false;
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,10 +358,13 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_slo) {
+            return m_latency_slo;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <condition_variable>
+#include <future>
 #include <thread>
 
+#include "batching_policy.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -31,6 +33,19 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // adaptive batching (nullptr for the batch of the fixed size collected within the timeout)
+        std::unique_ptr<BatchingPolicy> _policy;
+        // the batched request accepts any batch size up to the _batch_size, so the requests are packed densely
+        bool _dynamic_batch = false;
+        // full size buffers of the batched inputs of the dynamic batched request
+        std::vector<std::pair<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>>> _batched_tensors;
+        std::atomic<int> _num_requests = {0};
+        // the batch started by the adaptive batching, completed asynchronously (guarded by the _mutex)
+        bool _batch_in_flight = false;
+        bool _batch_completed = false;
+        size_t _batch_rows = 0;
+        BatchingPolicy::Clock::time_point _batch_start;
+        BatchingPolicy::Clock::duration _batch_duration{0};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -68,11 +83,16 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    void run_adaptive_batching(WorkerInferRequest& worker) const;
+    void launch_batch(WorkerInferRequest& worker,
+                      std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks,
+                      size_t num) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::uint32_t m_latency_slo = 0;              // in ms, 0 disables the adaptive batching
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
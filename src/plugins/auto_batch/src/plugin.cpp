@@ -22,6 +22,7 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +119,7 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_slo(0));  // adaptive batching is disabled by default
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -269,25 +271,38 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             compiled_model_config.insert(c);
     }
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
-        try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+    auto compile_batched = [&](const ov::Dimension& batch) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            ov::PartialShape input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch;
             }
+            partial_shapes.insert({input_id, input_shape});
+        }
 
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
-        } catch (const ov::Exception&) {
-            meta_device.device_batch_size = 1;
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
+    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+        // the adaptive batching prefers the device model accepting any batch size up to the max one,
+        // so the partial batches are executed without the padding
+        const auto latency_slo = full_properties.find(ov::auto_batch_latency_slo.name());
+        if (latency_slo != full_properties.end() && latency_slo->second.as<uint32_t>() > 0) {
+            try {
+                compiled_model_with_batch = compile_batched(ov::Dimension(1, meta_device.device_batch_size));
+            } catch (const ov::Exception&) {
+            }
+        }
+        if (!compiled_model_with_batch) {
+            try {
+                compiled_model_with_batch = compile_batched(meta_device.device_batch_size);
+            } catch (const ov::Exception&) {
+                meta_device.device_batch_size = 1;
+            }
         }
     }
 
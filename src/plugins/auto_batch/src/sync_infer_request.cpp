@@ -41,14 +41,51 @@ SyncInferRequest::SyncInferRequest(
       m_batched_request_wrapper(worker_request),
       m_batch_id(batch_id),
       m_batch_size(num_batch) {
-    if (m_batched_request_wrapper)
-        share_tensors_with_batched_req(batched_inputs, batched_outputs);
+    if (m_batched_request_wrapper) {
+        // the requests of the dynamic batch take different rows per execution, so the data is copied
+        if (m_batched_request_wrapper->_dynamic_batch)
+            allocate_own_tensors();
+        else
+            share_tensors_with_batched_req(batched_inputs, batched_outputs);
+    }
+}
+
+SyncInferRequest::~SyncInferRequest() {
+    if (m_batched_request_wrapper) {
+        m_batched_request_wrapper->_num_requests--;
+        if (m_batched_request_wrapper->_policy) {
+            // the requests collected by the adaptive batching may be all the remaining requests of the worker now
+            {
+                std::lock_guard<std::mutex> lock(m_batched_request_wrapper->_mutex);
+                m_batched_request_wrapper->_is_wakeup = true;
+            }
+            m_batched_request_wrapper->_cond.notify_one();
+        }
+    }
 }
 
 size_t SyncInferRequest::get_batch_size() const {
     return m_batch_size;
 }
 
+void SyncInferRequest::set_batch_position(size_t batch_id, size_t batch_size) {
+    OPENVINO_ASSERT(batch_id < batch_size, "Wrong position ", batch_id, " in the batch of ", batch_size);
+    m_batch_id = batch_id;
+    m_batch_size = batch_size;
+}
+
+void SyncInferRequest::allocate_own_tensors() {
+    auto allocate = [this](const ov::Output<const ov::Node>& port) {
+        allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+            tensor = ov::make_tensor(port.get_element_type(), port.get_shape());
+        });
+    };
+    for (const auto& input : get_inputs())
+        allocate(input);
+    for (const auto& output : get_outputs())
+        allocate(output);
+}
+
 void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                                       const std::set<std::size_t>& batched_outputs) {
     const auto inputs = get_inputs();
@@ -20,6 +20,8 @@ public:
                      const std::set<std::size_t>& batched_inputs = {},
                      const std::set<std::size_t>& batched_outputs = {});
 
+    ~SyncInferRequest() override;
+
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req);
 
@@ -45,12 +47,19 @@ public:
 
     size_t get_batch_size() const;
 
+    // Adaptive batching: sets the row of this request in the batch of the given size (which changes per execution)
+    void set_batch_position(size_t batch_id, size_t batch_size);
+
+    BatchingPolicy::Clock::time_point m_arrival_time;
+
 protected:
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
 
+    void allocate_own_tensors();
+
     size_t m_batch_id;
 
     size_t m_batch_size;
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "batching_policy.hpp"
+
+using ov::mock_autobatch_plugin::BatchingPolicy;
+using namespace std::chrono_literals;
+
+namespace {
+double to_ms(BatchingPolicy::Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+TEST(BatchingPolicyTest, DueImmediatelyWithoutMeasurements) {
+    BatchingPolicy policy(8, 100ms);
+    const auto arrival = BatchingPolicy::Clock::now();
+    EXPECT_EQ(policy.predict(4), BatchingPolicy::Clock::duration::zero());
+    EXPECT_EQ(policy.deadline(arrival, 4), arrival);
+}
+
+TEST(BatchingPolicyTest, DeadlineLeavesRoomForPredictedLatency) {
+    BatchingPolicy policy(8, 100ms);
+    for (int i = 0; i < 64; i++)
+        policy.update(8, 20ms);
+    // the deviation of the stable latency decays, so the prediction converges to the mean
+    EXPECT_NEAR(to_ms(policy.predict(8)), 20.0, 0.1);
+    const auto arrival = BatchingPolicy::Clock::now();
+    EXPECT_NEAR(to_ms(policy.deadline(arrival, 8) - arrival), 80.0, 0.1);
+}
+
+TEST(BatchingPolicyTest, UnmeasuredSizesUseClosestMeasured) {
+    BatchingPolicy policy(8, 100ms);
+    policy.update(2, 10ms);
+    policy.update(4, 16ms);
+    // the first sample is trusted with the deviation of a half
+    EXPECT_EQ(policy.predict(4), std::chrono::milliseconds(16 * 3));
+    EXPECT_EQ(policy.predict(3), policy.predict(4));
+    EXPECT_EQ(policy.predict(1), policy.predict(2));
+    EXPECT_EQ(policy.predict(8), policy.predict(4) * 2);
+}
+
+TEST(BatchingPolicyTest, LatencyAboveTargetIsDueImmediately) {
+    BatchingPolicy policy(4, 10ms);
+    policy.update(4, 50ms);
+    const auto arrival = BatchingPolicy::Clock::now();
+    EXPECT_EQ(policy.deadline(arrival, 4), arrival);
+}
+
+TEST(BatchingPolicyTest, WrongBatchSize) {
+    ASSERT_ANY_THROW(BatchingPolicy(0, 10ms));
+    BatchingPolicy policy(4, 10ms);
+    ASSERT_ANY_THROW(policy.update(5, 1ms));
+    ASSERT_ANY_THROW(policy.predict(0));
+}
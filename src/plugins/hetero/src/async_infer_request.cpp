@@ -21,19 +21,60 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+// Starts the subrequest via the pipeline stage shared with the other infer requests
+struct PipelinedRequestExecutor : ov::threading::ITaskExecutor {
+    PipelinedRequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                             const std::shared_ptr<ov::hetero::PipelineStage>& stage)
+        : m_request(request),
+          m_stage(stage) {
+        m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
+            finish(std::move(exception_ptr));
+        });
+    }
+    void run(ov::threading::Task task) override {
+        m_task = std::move(task);
+        m_stage->submit([this] {
+            try {
+                m_request->start_async();
+            } catch (...) {
+                finish(std::current_exception());
+            }
+        });
+    };
+    void finish(std::exception_ptr exception_ptr) {
+        m_exception_ptr = std::move(exception_ptr);
+        auto task = std::move(m_task);
+        // admit the next infer request to the submodel before this one proceeds to the next submodel
+        m_stage->complete();
+        task();
+    }
+    ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    std::shared_ptr<ov::hetero::PipelineStage> m_stage;
+    std::exception_ptr m_exception_ptr;
+    ov::threading::Task m_task;
+};
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
+    auto add_stage = [this](const auto& request_executor) {
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
             }
         });
+    };
+    const auto& stages = m_infer_request->m_pipeline_stages;
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); i++) {
+        auto& request = m_infer_request->m_subrequests[i];
+        if (stages.empty()) {
+            add_stage(std::make_shared<RequestExecutor>(request));
+        } else {
+            add_stage(std::make_shared<PipelinedRequestExecutor>(request, stages.at(i)));
+        }
     }
 }
 
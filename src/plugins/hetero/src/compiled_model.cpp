@@ -40,7 +40,8 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
 }
 
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    // the pipelined submodels must not be serialized via the single device executor
+    const bool add_exclusive = submodels.size() > 1 && m_cfg.pipeline_stage_requests == 0;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -75,6 +76,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    create_pipeline_stages();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -168,6 +170,16 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_pipeline_stages();
+}
+
+void ov::hetero::CompiledModel::create_pipeline_stages() {
+    m_pipeline_stages.clear();
+    if (m_cfg.pipeline_stage_requests == 0 || m_compiled_submodels.size() < 2)
+        return;
+    for (size_t i = 0; i < m_compiled_submodels.size(); i++) {
+        m_pipeline_stages.push_back(std::make_shared<PipelineStage>(m_cfg.pipeline_stage_requests));
+    }
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -236,6 +248,7 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipeline_stage_requests.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -261,6 +274,9 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                              comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
                                  .as<unsigned int>());
         }
+        // every stage of the pipeline must be fed with its own infer requests
+        value = std::max(value,
+                         static_cast<unsigned int>(m_pipeline_stages.size()) * m_cfg.pipeline_stage_requests);
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
         std::vector<std::string> device_names;
@@ -33,6 +33,16 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::pipeline_stage_requests == key) {
+            try {
+                pipeline_stage_requests = value.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               value.as<std::string>(),
+                               " for property key ",
+                               ov::hetero::pipeline_stage_requests.name(),
+                               ". Expected non-negative integer");
+            }
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +58,8 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::pipeline_stage_requests) {
+        return {pipeline_stage_requests};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +72,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::pipeline_stage_requests.name(), pipeline_stage_requests}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include "openvino/core/except.hpp"
+
+ov::hetero::PipelineStage::PipelineStage(size_t capacity) : m_capacity(capacity) {
+    OPENVINO_ASSERT(m_capacity > 0, "Capacity of the pipeline stage must be positive");
+}
+
+void ov::hetero::PipelineStage::submit(std::function<void()> start) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_in_flight == m_capacity) {
+            m_queue.emplace_back(std::move(start));
+            return;
+        }
+        m_in_flight++;
+    }
+    start();
+}
+
+void ov::hetero::PipelineStage::complete() {
+    std::function<void()> next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_queue.empty()) {
+            OPENVINO_ASSERT(m_in_flight > 0, "Pipeline stage has no requests in flight");
+            m_in_flight--;
+            return;
+        }
+        // the slot is passed to the next request
+        next = std::move(m_queue.front());
+        m_queue.pop_front();
+    }
+    next();
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Bounded queue in front of a submodel in the pipelined execution mode.
+ * The subrequests of the different infer requests are started in the arrival order and at most `capacity` of them
+ * are in flight at once, so the next submodel of an earlier infer request overlaps with this submodel of a later one.
+ * The tensors between the submodels are handed off without copies since every infer request owns its subrequests.
+ */
+class PipelineStage {
+public:
+    explicit PipelineStage(size_t capacity);
+
+    /**
+     * @brief Starts the subrequest immediately if the stage has a free slot, otherwise queues it
+     * @param start the callable starting the subrequest
+     */
+    void submit(std::function<void()> start);
+
+    /**
+     * @brief Releases the slot of the completed subrequest and starts the oldest queued one
+     */
+    void complete();
+
+    size_t get_capacity() const {
+        return m_capacity;
+    }
+
+private:
+    const size_t m_capacity;
+    std::mutex m_mutex;
+    std::deque<std::function<void()>> m_queue;
+    size_t m_in_flight = 0;
+};
+
+}  // namespace hetero
+}  // namespace ov
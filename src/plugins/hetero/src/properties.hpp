@@ -17,5 +17,12 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Read-write property to enable the pipelined execution of the submodels: the submodels of the different infer
+ * requests overlap, each submodel executes at most the given number of infer requests at once in the arrival order.
+ * The default value 0 keeps the submodels of the device serialized via the exclusive device executor.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_stage_requests{"HETERO_PIPELINE_STAGE_REQUESTS"};
 }  // namespace hetero
 }  // namespace ov
@@ -18,7 +18,8 @@
 #include "remote_tensor.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
-    : ov::ISyncInferRequest(compiled_model) {
+    : ov::ISyncInferRequest(compiled_model),
+      m_pipeline_stages(compiled_model->m_pipeline_stages) {
     for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
         auto& comp_model = comp_model_desc.compiled_model;
         m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
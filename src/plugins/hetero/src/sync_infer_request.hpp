@@ -15,6 +15,7 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 
 namespace ov {
 namespace hetero {
@@ -52,6 +53,8 @@ private:
 
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+    // empty unless the pipelined execution is enabled
+    std::vector<std::shared_ptr<PipelineStage>> m_pipeline_stages;
 };
 
 }  // namespace hetero
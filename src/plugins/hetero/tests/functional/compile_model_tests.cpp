@@ -6,6 +6,7 @@
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -99,6 +100,30 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, pipelined_infer_requests) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::pipeline_stage_requests(1)};
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(1, compiled_model.get_property(ov::hetero::pipeline_stage_requests));
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<ov::Tensor> input_tensors;
+    for (size_t i = 0; i < 4; i++) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+        input_tensors.push_back(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+        infer_requests.back().set_input_tensor(input_tensors.back());
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.start_async();
+    }
+    for (size_t i = 0; i < infer_requests.size(); i++) {
+        infer_requests[i].wait();
+        auto output_tensor = infer_requests[i].get_output_tensor();
+        ASSERT_EQ(input_tensors[i].get_shape(), output_tensor.get_shape());
+        EXPECT_EQ(memcmp(input_tensors[i].data(), output_tensor.data(), input_tensors[i].get_byte_size()), 0);
+    }
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -15,7 +15,8 @@ TEST_F(HeteroTests, get_property_supported_properties) {
                                                                 ov::device::full_name,
                                                                 ov::device::capabilities,
                                                                 ov::device::priorities,
-                                                                ov::hint::model_distribution_policy};
+                                                                ov::hint::model_distribution_policy,
+                                                                ov::hetero::pipeline_stage_requests};
     auto actual_supported_properties = core.get_property(ov::test::utils::DEVICE_HETERO, ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
@@ -65,6 +66,15 @@ TEST_F(HeteroTests, set_property_ModelDistributionPolicy) {
     ASSERT_NO_THROW(value = core.get_property(ov::test::utils::DEVICE_HETERO, ov::hint::model_distribution_policy));
     ASSERT_EQ(model_policy, value);
 }
+
+TEST_F(HeteroTests, set_property_pipeline_stage_requests) {
+    EXPECT_EQ(0, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_stage_requests));
+    core.set_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_stage_requests(2));
+    EXPECT_EQ(2, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_stage_requests));
+    EXPECT_THROW(
+        core.set_property(ov::test::utils::DEVICE_HETERO, {{ov::hetero::pipeline_stage_requests.name(), "abc"}}),
+        ov::Exception);
+}
 }  // namespace tests
 }  // namespace hetero
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+using namespace ov::hetero;
+
+TEST(PipelineStageTest, StartsUpToCapacity) {
+    PipelineStage stage(2);
+    std::vector<int> started;
+    for (int i = 0; i < 4; i++) {
+        stage.submit([&started, i] {
+            started.push_back(i);
+        });
+    }
+    EXPECT_EQ(started, std::vector<int>({0, 1}));
+    stage.complete();
+    EXPECT_EQ(started, std::vector<int>({0, 1, 2}));
+    stage.complete();
+    stage.complete();
+    EXPECT_EQ(started, std::vector<int>({0, 1, 2, 3}));
+    stage.complete();
+    // the slots are free again
+    stage.submit([&started] {
+        started.push_back(4);
+    });
+    stage.submit([&started] {
+        started.push_back(5);
+    });
+    EXPECT_EQ(started, std::vector<int>({0, 1, 2, 3, 4, 5}));
+}
+
+TEST(PipelineStageTest, NextStartsFromCompletion) {
+    PipelineStage stage(1);
+    std::vector<int> started;
+    // the completion of the started request admits the queued one, as the subrequest callback does
+    stage.submit([&] {
+        started.push_back(0);
+    });
+    stage.submit([&] {
+        started.push_back(1);
+        stage.complete();
+    });
+    EXPECT_EQ(started, std::vector<int>({0}));
+    stage.complete();
+    EXPECT_EQ(started, std::vector<int>({0, 1}));
+}
+
+TEST(PipelineStageTest, ZeroCapacityIsNotAllowed) {
+    EXPECT_THROW(PipelineStage(0), ov::Exception);
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -13,11 +14,29 @@
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Cache usage counters accumulated since the cache creation
+ */
+struct CacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
@@ -26,7 +45,8 @@ public:
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
  * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * KeyType&) interface and must have constructor of type ImplType(size_t). It must also provide getCapacity() and
+ * getEvicted() methods.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -57,15 +77,32 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            // in case of a thread safe ImplType several threads may build the same value concurrently,
+            // the last one wins, which is fine since the values built from equal keys are equivalent
             retVal = builder(key);
             if (retVal != retEmpty) {
                 _impl.put(key, retVal);
             }
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] CacheStatistics getStatistics() const override {
+        CacheStatistics retVal;
+        retVal.hits = _hits.load(std::memory_order_relaxed);
+        retVal.misses = _misses.load(std::memory_order_relaxed);
+        retVal.evictions = _impl.getEvicted();
+        return retVal;
+    }
+
     ImplType _impl;
+
+private:
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
 };
 
 }  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <unordered_map>
@@ -75,6 +76,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            _evicted.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
@@ -86,6 +88,15 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records evicted from the cache since its creation
+     * @return the number of evicted records
+     * @note May be called concurrently with the cache modifications
+     */
+    [[nodiscard]] size_t getEvicted() const noexcept {
+        return _evicted.load(std::memory_order_relaxed);
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -103,6 +114,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    std::atomic<size_t> _evicted{0};
 };
 
 }  // namespace ov::intel_cpu
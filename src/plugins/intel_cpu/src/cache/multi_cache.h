@@ -7,32 +7,45 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default this implementation IS NOT THREAD SAFE! The thread safe mode, which allows to share a single
+ * cache instance between several streams, must be requested explicitly on construction.
  */
 
 class MultiCache {
 public:
     template <typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template <typename KeyType, typename ValueType>
+    using SharedEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param threadSafe enables the mode in which getOrCreate may be called concurrently from different threads.
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _threadSafe(other._threadSafe) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
+
+    MultiCache& operator=(const MultiCache& other) = delete;
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,18 +60,42 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_threadSafe) {
+            auto entry = getEntry<SharedEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Accumulates the usage counters over all the entries
+     * @note May be called concurrently with getOrCreate in both modes: the counters are atomic and the entries are
+     * added under the storage mutex
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        CacheStatistics retVal;
+        std::lock_guard<std::mutex> lock(_storageMutex);
+        for (const auto& item : _storage) {
+            retVal += item.second->getStatistics();
+        }
+        return retVal;
+    }
+
+    [[nodiscard]] bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,12 +105,20 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_threadSafe) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
+        // in the non thread safe mode the storage is modified by the owning thread only, so only the modification is
+        // guarded against the concurrent getStatistics() calls
+        if (!_threadSafe) {
+            lock.lock();
+        }
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
         itr = result.first;
     }
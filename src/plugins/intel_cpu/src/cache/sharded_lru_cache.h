@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The key space is split into a fixed number of shards. Each shard is an independent LruCache guarded by its own
+ * mutex, so concurrent lookups of different keys from different threads rarely contend on the same lock.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type and must be
+ * copyable in a thread safe manner (e.g. std::shared_ptr)
+ *
+ * @note The LRU policy is maintained per shard, so the eviction order is only approximately global.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    static constexpr size_t defaultShardsNum = 16;
+
+    /**
+     * @param capacity is the total records limit, which is evenly distributed between the shards
+     * @param shardsNum is the maximum number of shards, the actual number never exceeds the capacity
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        const size_t numShards = std::max<size_t>(1, std::min(shardsNum, capacity));
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts up to n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvicted() const {
+        size_t evicted = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evicted += shard->cache.getEvicted();
+        }
+        return evicted;
+    }
+
+private:
+    // aligned to the cache line size to avoid false sharing of the mutexes of the neighbouring shards
+    struct alignas(64) Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        const size_t hash = key.hash();
+        // mix the high bits in since the hash values are often combined from the small integers
+        return *_shards[(hash ^ (hash >> 16)) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,34 +5,46 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
 #include "config.h"
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "perf_count.h"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -58,7 +70,36 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+namespace {
+// The weights cache keys of the prepacked weights end with the address of the source constant data
+std::unordered_map<std::string, std::string> get_constants_addresses(const std::shared_ptr<const ov::Model>& model) {
+    std::unordered_map<std::string, std::string> name_to_address;
+    std::unordered_map<std::string, size_t> names_count;
+    std::unordered_map<std::string, size_t> addresses_count;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant || constant->get_element_type() == ov::element::string || constant->get_byte_size() == 0) {
+            continue;
+        }
+        auto address = std::to_string(reinterpret_cast<uint64_t>(constant->get_data_ptr()));
+        names_count[constant->get_friendly_name()]++;
+        addresses_count[address]++;
+        name_to_address.emplace(constant->get_friendly_name(), std::move(address));
+    }
+    // only the constants which can be unambiguously identified by both the name and the address are taken
+    for (auto it = name_to_address.begin(); it != name_to_address.end();) {
+        if (names_count[it->first] > 1 || addresses_count[it->second] > 1) {
+            it = name_to_address.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return name_to_address;
+}
+}  // namespace
+
 CompiledModel::~CompiledModel() {
+    wait_warm_up();
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -74,13 +115,18 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const std::vector<PackedWeights>& packed_weights,
+                             const std::shared_ptr<SocketsWeights>& shared_weights,
+                             KVCachePool::Ptr kv_cache_pool)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(shared_weights),
+      m_kvCachePool(std::move(kv_cache_pool)),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -116,33 +162,76 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
-    int streams = std::max(1, executor_config.get_streams());
-    std::vector<Task> tasks;
-    tasks.resize(streams);
-    m_graphs.resize(streams);
-    if (executor_config.get_streams() != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
+    if (!packed_weights.empty() && m_cfg.numSubStreams == 0) {
+        preload_packed_weights(packed_weights);
+    }
+
+    const int streams = std::max(1, executor_config.get_streams());
+    auto create_graphs = [&](int graphs_number) {
+        std::vector<Task> tasks;
+        tasks.resize(graphs_number);
+        m_graphs.resize(graphs_number);
+        if (executor_config.get_streams() != 0) {
+            auto all_graphs_ready = [&] {
+                return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
+                    return graph.IsReady();
+                });
+            };
+            do {
+                for (auto&& task : tasks) {
+                    task = [this] {
 #if defined(OV_CPU_WITH_ACL)
-                    static std::once_flag flag_once;
-                    std::call_once(flag_once, [&]() {
-                        std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
-                        arm_compute::Scheduler::set(std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
-                    });
+                        static std::once_flag flag_once;
+                        std::call_once(flag_once, [&]() {
+                            std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
+                            arm_compute::Scheduler::set(
+                                std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
+                        });
 #endif
-                    CompiledModel::get_graph();
-                };
-            }
-            m_task_executor->run_and_wait(tasks);
-        } while (!all_graphs_ready());
+                        CompiledModel::get_graph();
+                    };
+                }
+                m_task_executor->run_and_wait(tasks);
+            } while (!all_graphs_ready());
+        } else {
+            CompiledModel::get_graph();
+        }
+    };
+    if (m_cfg.maxMemory > 0 && streams > 1) {
+        // the footprint of a graph is measured on the first one, the streams share the graphs which fit into the limit
+        create_graphs(1);
+        create_graphs(get_graphs_number_within_memory_limit(streams));
     } else {
-        CompiledModel::get_graph();
+        create_graphs(streams);
+    }
+    m_predictedPeakMemory = get_allocated_memory_size();
+    // the estimation by the first graph misses the memory which is not shared by the graphs, e.g. the weights
+    // replicated for the other sockets, so the graphs are dropped until the model fits
+    while (m_cfg.maxMemory > 0 && m_predictedPeakMemory > m_cfg.maxMemory && m_graphs.size() > 1) {
+        m_graphs.pop_back();
+        m_predictedPeakMemory = get_allocated_memory_size();
+    }
+    DEBUG_LOG("Predicted peak memory of ", m_name, ": ", m_predictedPeakMemory, " bytes, graphs: ", m_graphs.size());
+    if (m_cfg.maxMemory > 0 && m_predictedPeakMemory > m_cfg.maxMemory) {
+        OPENVINO_THROW("The memory of the model ",
+                       m_name,
+                       " (",
+                       m_predictedPeakMemory,
+                       " bytes) exceeds the limit set by ",
+                       ov::intel_cpu::max_memory.name(),
+                       " (",
+                       m_cfg.maxMemory,
+                       " bytes)");
+    }
+    if (m_cfg.maxMemory > 0) {
+        set_graphs_memory_limit();
+    }
+    // the static graphs have already created all the executors, so the unused prepacked weights may be released,
+    // the used ones are held by the nodes
+    if (std::all_of(m_graphs.begin(), m_graphs.end(), [](const Graph& graph) {
+            return graph.IsStatic();
+        })) {
+        m_packedWeights.clear();
     }
     if (m_cfg.numSubStreams > 0) {
         m_has_sub_compiled_models = true;
@@ -167,9 +256,29 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                     std::move(sub_streams_table),
                                                                     sub_cfg.streamsRankTable[i]};
             m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+                std::make_shared<CompiledModel>(model,
+                                                plugin,
+                                                sub_cfg,
+                                                loaded_from_cache,
+                                                m_sub_memory_manager,
+                                                std::vector<PackedWeights>{},
+                                                nullptr,
+                                                m_kvCachePool));
         }
     }
+    if (!m_cfg.shapeBuckets.empty()) {
+        warm_up_async(m_cfg.shapeBuckets);
+    }
+}
+
+CompiledModel::GraphGuard::Lock::~Lock() {
+    // the readers of the latency profiles don't wait for the inference, they take the snapshot published here instead
+    if (owns_lock() && _graph._latencySnapshotRequested.exchange(false) && _graph.IsReady()) {
+        std::vector<NodeLatencyRecord> records;
+        _graph.GetLatencyProfiles(records);
+        std::lock_guard<std::mutex> lock(_graph._snapshotMutex);
+        _graph._latencySnapshot = std::move(records);
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -198,11 +307,22 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                     std::lock_guard<std::mutex> lock{*m_mutex};
                     auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
+                    MultiCachePtr primitivesCache;
+                    if (m_cfg.rtCacheShared) {
+                        auto& socketCache = m_socketPrimitivesCaches[socketId];
+                        if (!socketCache) {
+                            socketCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+                        }
+                        primitivesCache = socketCache;
+                    }
                     ctx = std::make_shared<GraphContext>(m_cfg,
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         primitivesCache,
+                                                         m_kvCachePool);
+                    graphLock._graph._paramsCache = ctx->getParamsCache();
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -224,6 +344,103 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     return graphLock;
 }
 
+int CompiledModel::get_graphs_number_within_memory_limit(int streams) const {
+    // the constants used in place are the data of the model, which are shared by all the graphs
+    std::unordered_set<const void*> counted;
+    const uint64_t weights_size = m_socketWeights.memorySize() + m_graphs.front().GetConstantsMemorySize(counted);
+    const uint64_t graph_size = m_graphs.front().GetAllocatedMemorySize();
+    if (weights_size + graph_size > m_cfg.maxMemory) {
+        OPENVINO_THROW("The memory of the model ",
+                       m_name,
+                       " (",
+                       weights_size + graph_size,
+                       " bytes) exceeds the limit set by ",
+                       ov::intel_cpu::max_memory.name(),
+                       " (",
+                       m_cfg.maxMemory,
+                       " bytes)");
+    }
+    if (graph_size == 0) {
+        return streams;
+    }
+    const auto graphs_number = (m_cfg.maxMemory - weights_size) / graph_size;
+    return static_cast<int>(std::min<uint64_t>(streams, graphs_number));
+}
+
+void CompiledModel::set_graphs_memory_limit() {
+    // the weights and the constants are shared by the graphs, the rest of the limit is split between them
+    std::unordered_set<const void*> counted;
+    uint64_t shared_size = m_socketWeights.memorySize();
+    for (auto&& graph : m_graphs) {
+        shared_size += graph.GetConstantsMemorySize(counted);
+    }
+    const auto graph_limit = (m_cfg.maxMemory - std::min(m_cfg.maxMemory, shared_size)) / m_graphs.size();
+    for (auto&& graph : m_graphs) {
+        // the memory of the static graph is allocated once by the compilation
+        if (!graph.IsStatic()) {
+            graph._memoryLimit = graph_limit;
+        }
+    }
+}
+
+uint64_t CompiledModel::get_allocated_memory_size() const {
+    uint64_t size = m_socketWeights.memorySize();
+    std::unordered_set<const void*> counted;
+    for (auto&& graph : m_graphs) {
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        if (graph.IsReady()) {
+            size += graph.GetAllocatedMemorySize() + graph.GetConstantsMemorySize(counted);
+        }
+    }
+    return size;
+}
+
+CacheStatistics CompiledModel::get_params_cache_statistics() const {
+    CacheStatistics statistics;
+    // the counters are atomic, so the caches of the streams are read without waiting for their inference
+    std::lock_guard<std::mutex> lock{*m_mutex};
+    for (const auto& item : m_socketPrimitivesCaches) {
+        statistics += item.second->getStatistics();
+    }
+    for (const auto& graph : m_graphs) {
+        if (graph._paramsCache) {
+            statistics += graph._paramsCache->getStatistics();
+        }
+    }
+    return statistics;
+}
+
+std::vector<NodeLatencyRecord> CompiledModel::get_latency_profiles() const {
+    std::vector<NodeLatencyRecord> records;
+    std::unordered_map<std::string, size_t> recordIndices;
+    for (auto&& graph : m_graphs) {
+        std::vector<NodeLatencyRecord> graphRecords;
+        // the histograms are recorded by the inference: an idle graph is read directly, a busy one is not waited for,
+        // its snapshot published at the end of the previously requested inference is taken and a new one is requested
+        std::unique_lock<std::mutex> graphLock(graph._mutex, std::try_to_lock);
+        if (graphLock.owns_lock()) {
+            if (!graph.IsReady()) {
+                continue;
+            }
+            graph.GetLatencyProfiles(graphRecords);
+        } else {
+            graph._latencySnapshotRequested = true;
+            std::lock_guard<std::mutex> lock(graph._snapshotMutex);
+            graphRecords = graph._latencySnapshot;
+        }
+        for (auto& record : graphRecords) {
+            auto found = recordIndices.find(record.name);
+            if (found == recordIndices.end()) {
+                recordIndices.emplace(record.name, records.size());
+                records.push_back(std::move(record));
+            } else {
+                records[found->second].profile.merge(record.profile);
+            }
+        }
+    }
+    return records;
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     return std::make_shared<SyncInferRequest>(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
@@ -261,6 +478,30 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        // the executors built by the warm up are accounted once it is done
+        wait_warm_up();
+        const auto statistics = get_params_cache_statistics();
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{
+            {"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions}};
+    }
+
+    if (name == ov::intel_cpu::latency_histograms_dump) {
+        return decltype(ov::intel_cpu::latency_histograms_dump)::value_type(
+            dumpLatencyProfiles(get_latency_profiles()));
+    }
+
+    if (name == ov::intel_cpu::predicted_peak_memory) {
+        return decltype(ov::intel_cpu::predicted_peak_memory)::value_type(m_predictedPeakMemory);
+    }
+
+    if (name == ov::intel_cpu::compile_time_breakdown) {
+        return decltype(ov::intel_cpu::compile_time_breakdown)::value_type(
+            get_graph()._graph.GetCompileTimeBreakdown());
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -304,6 +545,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
             RO_property(ov::value_cache_group_size.name()),
+            RO_property(ov::compilation_num_threads.name()),
         };
 
         return ro_properties;
@@ -400,15 +642,170 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::value_cache_group_size) {
         return static_cast<decltype(ov::value_cache_group_size)::value_type>(config.valueCacheGroupSize);
     }
+    if (name == ov::compilation_num_threads) {
+        return static_cast<decltype(ov::compilation_num_threads)::value_type>(config.compilationThreads);
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& [name, value] : properties) {
+        if (name == ov::internal::cache_writer.name()) {
+            m_cacheWriter = value.as<ov::internal::CacheWriter>();
+            m_cachedShapeProfileSize = m_shapeProfile.size();
+            continue;
+        }
+        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
+                                       "Set property to Core::compile_model during compilation");
+    }
+}
+
+void CompiledModel::update_cache_entry() const {
+    // the cache entry is written right after the compilation, so the shapes observed by the inferences are saved here
+    if (!m_cacheWriter || m_shapeProfile.size() <= m_cachedShapeProfileSize) {
+        return;
+    }
+    try {
+        m_cacheWriter([this](std::ostream& modelStream) {
+            export_model(modelStream);
+        });
+    } catch (const std::exception& exp) {
+        // the previous cache entry is still valid, it just lacks the shape profile
+        DEBUG_LOG("Update of the cache entry of the model ", m_name, " failed: ", exp.what());
+    } catch (...) {
+        DEBUG_LOG("Update of the cache entry of the model ", m_name, " failed");
+    }
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_shapeProfile.get(), get_packed_weights());
     serializer << m_model;
 }
 
+void CompiledModel::warm_up_async(std::vector<ShapeProfile::InputShapes> shape_profile) {
+    if (shape_profile.empty() || m_has_sub_compiled_models) {
+        return;
+    }
+    wait_warm_up();
+    for (auto&& graph : m_graphs) {
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        graph._warmUpPending = true;
+    }
+    // the executors are built by the threads of the stream which runs the graph and its memory is placed on the
+    // socket of the stream, a graph of the stream which hasn't taken any task builds them on its first inference
+    auto profile = std::make_shared<const std::vector<ShapeProfile::InputShapes>>(std::move(shape_profile));
+    auto remaining = std::make_shared<std::atomic<size_t>>(m_graphs.size());
+    auto done = std::make_shared<std::promise<void>>();
+    m_warmUpDone = done->get_future().share();
+    for (size_t i = 0; i < m_graphs.size(); i++) {
+        m_task_executor->run([this, profile, remaining, done] {
+            try {
+                auto graphLock = get_graph();
+                if (graphLock._graph._warmUpPending) {
+                    graphLock._graph._warmUpPending = false;
+                    warm_up_graph(graphLock._graph, *profile);
+                }
+            } catch (const std::exception& exp) {
+                DEBUG_LOG("Warm up of the model ", m_name, " failed: ", exp.what());
+            }
+            if (--(*remaining) == 0) {
+                done->set_value();
+            }
+        });
+    }
+}
+
+void CompiledModel::wait_warm_up() const {
+    if (m_warmUpDone.valid()) {
+        m_warmUpDone.wait();
+    }
+}
+
+std::vector<PackedWeights> CompiledModel::get_packed_weights() const {
+    std::vector<PackedWeights> packed_weights;
+    // the weights of the sub models are split between the sub streams and cannot be shared this way
+    if (m_has_sub_compiled_models) {
+        return packed_weights;
+    }
+
+    std::unordered_map<std::string, std::string> address_to_name;
+    for (const auto& item : get_constants_addresses(m_model)) {
+        address_to_name.emplace(item.second, item.first);
+    }
+
+    // the weights are the same on all the sockets, so the first non empty cache is taken
+    std::vector<std::pair<std::string, MemoryPtr>> cached_weights;
+    for (int socket_id = 0; socket_id < get_num_sockets() && cached_weights.empty(); socket_id++) {
+        cached_weights = m_socketWeights[socket_id]->snapshot();
+    }
+
+    for (auto& [key, memory] : cached_weights) {
+        const auto pos = key.rfind('_');
+        if (pos == std::string::npos) {
+            continue;
+        }
+        const auto name = address_to_name.find(key.substr(pos + 1));
+        if (name == address_to_name.end() || !memory->getDesc().isDefined()) {
+            continue;
+        }
+        PackedWeights weights;
+        weights.key_prefix = key.substr(0, pos + 1);
+        weights.constant_name = name->second;
+        weights.desc = MemoryDescUtils::convertToDnnlMemoryDesc(memory->getDescPtr())->getDnnlDesc().get_blob();
+        weights.data = memory->getData();
+        weights.size = memory->getSize();
+        weights.holder = std::move(memory);
+        packed_weights.push_back(std::move(weights));
+    }
+    return packed_weights;
+}
+
+void CompiledModel::preload_packed_weights(const std::vector<PackedWeights>& packed_weights) {
+    const auto name_to_address = get_constants_addresses(m_model);
+    for (const auto& weights : packed_weights) {
+        const auto address = name_to_address.find(weights.constant_name);
+        if (address == name_to_address.end()) {
+            continue;
+        }
+        auto desc = DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(weights.desc));
+        if (desc->getCurrentMemSize() != weights.size) {
+            continue;
+        }
+        // the memory refers to the blob data directly (read only if mapped), so the padding must not be touched
+        MemoryPtr memory(new Memory(GraphContext::getEngine(), desc, weights.data, false),
+                         [holder = weights.holder](Memory* ptr) {
+                             delete ptr;
+                         });
+        const auto key = weights.key_prefix + address->second;
+        for (int socket_id = 0; socket_id < get_num_sockets(); socket_id++) {
+            m_socketWeights[socket_id]->findOrCreate(key, [&memory]() {
+                return memory;
+            });
+        }
+        m_packedWeights.push_back(std::move(memory));
+    }
+}
+
+void CompiledModel::warm_up_graph(Graph& graph, const std::vector<ShapeProfile::InputShapes>& shape_profile) const {
+    if (!graph.IsDynamic() || !graph.memoryStates().empty()) {
+        return;
+    }
+    for (const auto& input_shapes : shape_profile) {
+        try {
+            graph.WarmUp(input_shapes);
+        } catch (const std::exception& exp) {
+            // the warm up is only an optimization, the shapes which cannot be processed are skipped
+            DEBUG_LOG("Warm up of the graph ", graph.GetName(), " failed: ", exp.what());
+            continue;
+        }
+        m_shapeProfile.record(input_shapes);
+    }
+}
+
 void CompiledModel::release_memory() {
+    wait_warm_up();
+    // the model is idle, so the export does not delay the inferences
+    update_cache_entry();
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
         std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -13,17 +16,23 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "kv_cache_pool.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "perf_count.h"
+#include "shape_profile.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/serialize.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -34,8 +43,26 @@ public:
 
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // the background warm up is dropped once the graph runs an inference, since the graph memory is bound to the
+        // tensors of the infer requests then
+        bool _warmUpPending = false;
+        // the share of the graph in the Config::maxMemory limit checked after the inferences, since the dynamic graph
+        // allocates the memory of the shapes it is inferred with (0 if not limited)
+        uint64_t _memoryLimit = 0;
+
+        // The statistics of the graph readable without waiting for its inference, see get_params_cache_statistics()
+        // and get_latency_profiles()
+        std::mutex _snapshotMutex;
+        // the cache of the stream, set once the graph is created (guarded by the mutex of the compiled model)
+        MultiCacheCPtr _paramsCache;
+        // the latency profiles published on the unlock of the graph if requested by a reader
+        std::vector<NodeLatencyRecord> _latencySnapshot;
+        std::atomic_bool _latencySnapshotRequested{false};
+
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            Lock(Lock&&) = default;
+            ~Lock();
             GraphGuard& _graph;
         };
     };
@@ -44,7 +71,10 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  const std::vector<PackedWeights>& packed_weights = {},
+                  const std::shared_ptr<SocketsWeights>& shared_weights = nullptr,
+                  KVCachePool::Ptr kv_cache_pool = nullptr);
 
     ~CompiledModel() override;
 
@@ -56,13 +86,17 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
+    /**
+     * @brief Starts the warm up for the given input shapes on the task executor of the compiled model: every task warms
+     * up the graph of the stream it runs on. The infer requests don't wait for it, a graph which has run an inference
+     * before its warm up task is not warmed up.
+     */
+    void warm_up_async(std::vector<ShapeProfile::InputShapes> shape_profile);
+
     std::string name() const {
         return m_name;
     }
@@ -87,6 +121,21 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    KVCachePool::Ptr m_kvCachePool;
+    // input shapes the dynamic model has been inferred with, saved on export
+    mutable ShapeProfile m_shapeProfile;
+    // rewrites the model cache entry (see ov::internal::cache_writer) by release_memory(), if the shape profile has
+    // grown since the entry was written
+    ov::internal::CacheWriter m_cacheWriter;
+    size_t m_cachedShapeProfileSize = 0;
+    // per socket caches of the immutable primitives shared between the streams (if enabled)
+    mutable std::map<int, MultiCachePtr> m_socketPrimitivesCaches;
+    // completion of the warm up tasks
+    std::shared_future<void> m_warmUpDone;
+    // prepacked weights imported from the blob, held until the graphs stop creating the executors
+    std::vector<MemoryPtr> m_packedWeights;
+    // weights and graphs memory measured after the compilation (see ov::intel_cpu::predicted_peak_memory)
+    uint64_t m_predictedPeakMemory = 0;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +143,44 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    void wait_warm_up() const;
+
+    void warm_up_graph(Graph& graph, const std::vector<ShapeProfile::InputShapes>& shape_profile) const;
+
+    void update_cache_entry() const;
+
+    CacheStatistics get_params_cache_statistics() const;
+
+    /**
+     * @brief Returns the number of graphs (up to the number of streams) fitting into the Config::maxMemory limit,
+     * measured on the first graph created
+     */
+    int get_graphs_number_within_memory_limit(int streams) const;
+    /**
+     * @brief Splits the Config::maxMemory limit left by the weights between the dynamic graphs, see
+     * GraphGuard::_memoryLimit
+     */
+    void set_graphs_memory_limit();
+    /**
+     * @brief Returns the size of the weights (both cached and used in place) and the memory allocated by the ready
+     * graphs
+     */
+    uint64_t get_allocated_memory_size() const;
+
+    /**
+     * @brief Collects the latency histograms of the nodes merged across the graphs of the streams
+     */
+    std::vector<NodeLatencyRecord> get_latency_profiles() const;
+
+    /**
+     * @brief Collects the prepacked weights of the constants from the weights cache to be stored in the blob
+     */
+    std::vector<PackedWeights> get_packed_weights() const;
+    /**
+     * @brief Puts the imported prepacked weights into the weights cache under the keys the nodes will look them up by
+     */
+    void preload_packed_weights(const std::vector<PackedWeights>& packed_weights);
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -135,6 +222,7 @@ public:
 
     CompiledModel::GraphGuard::Lock lock() {
         auto lock = m_compiled_model->get_graph();
+        lock._graph._warmUpPending = false;
         m_graph = &(lock._graph);
         OPENVINO_ASSERT(m_graph, "Graph ptr null check failed");
         return lock;
@@ -152,6 +240,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] bool shape_profile_full() const {
+        return m_compiled_model->m_shapeProfile.isFull();
+    }
+
+    void record_input_shapes(const ShapeProfile::InputShapes& shapes) const {
+        m_compiled_model->m_shapeProfile.record(shapes);
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
@@ -21,6 +21,7 @@
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "shape_profile.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/precision_support.h"
@@ -113,6 +114,19 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::num_requests.name(),
                                ". Expected only >= 0.");
             }
+        } else if (key == ov::compilation_num_threads.name()) {
+            try {
+                ov::Any value = val.as<std::string>();
+                int val_i = value.as<int>();
+                OPENVINO_ASSERT(val_i > 0, "invalid value.");
+                compilationThreads = val_i;
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::compilation_num_threads.name(),
+                               ". Expected only positive integer numbers");
+            }
         } else if (key == ov::hint::enable_cpu_pinning.name()) {
             try {
                 enableCpuPinning = val.as<bool>();
@@ -274,6 +288,88 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::shape_buckets.name() == key) {
+            try {
+                shapeBuckets = parseShapeBuckets(val.as<std::string>());
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shape_buckets.name(),
+                               ". Expected ';' separated lists of the bracketed bounded input shapes");
+            }
+        } else if (ov::intel_cpu::kv_cache_memory_budget.name() == key) {
+            try {
+                kvCacheMemoryBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_memory_budget.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (ov::intel_cpu::kv_cache_offload_budget.name() == key) {
+            try {
+                kvCacheOffloadBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_offload_budget.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (ov::intel_cpu::kv_cache_offload_dir.name() == key) {
+            kvCacheOffloadDir = val.as<std::string>();
+        } else if (ov::intel_cpu::memory_allocation_mode.name() == key) {
+            try {
+                memoryAllocationMode = val.as<ov::intel_cpu::MemoryAllocationMode>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_allocation_mode.name(),
+                               ". Expected values: DEFAULT/NUMA/TRANSPARENT_HUGE_PAGES/HUGE_PAGES");
+            }
+        } else if (ov::intel_cpu::max_memory.name() == key) {
+            try {
+                maxMemory = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::max_memory.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (ov::intel_cpu::weight_only_fc.name() == key) {
+            try {
+                weightOnlyFC = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weight_only_fc.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::latency_histograms.name() == key) {
+            try {
+                collectLatencyHistograms = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::latency_histograms.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -13,11 +13,13 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "shape_profile.hpp"
 #include "utils/debug_caps_config.h"
 
 namespace ov::intel_cpu {
@@ -50,6 +52,10 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    // record the per node latency histograms across the inferences
+    bool collectLatencyHistograms = false;
+    // the weight-only FullyConnected executor for the nodes with the small number of rows
+    bool weightOnlyFC = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
@@ -72,6 +78,10 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    std::vector<ShapeProfile::InputShapes> shapeBuckets;
+    // the number of threads the independent nodes of the graph are compiled with, 1 means the serial compilation
+    int compilationThreads = 1;
 #if defined(OPENVINO_ARCH_X86_64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -83,6 +93,16 @@ struct Config {
 #endif
     size_t keyCacheGroupSize = 0UL;
     size_t valueCacheGroupSize = 0UL;
+    // plugin-wide limit of the KV cache memory in bytes, 0 means no limit
+    uint64_t kvCacheMemoryBudget = 0UL;
+    // plugin-wide limit of the offloaded KV cache states in bytes, 0 means no limit
+    uint64_t kvCacheOffloadBudget = 0UL;
+    // directory of the offload file of the KV cache states, empty means the temporary directory of the system
+    std::string kvCacheOffloadDir;
+    // allocation of the graph memory: huge pages and NUMA binding to the node of the stream
+    MemoryAllocationMode memoryAllocationMode = MemoryAllocationMode::DEFAULT;
+    // limit of the weights and the graphs memory of the compiled model in bytes, 0 means no limit
+    uint64_t maxMemory = 0UL;
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
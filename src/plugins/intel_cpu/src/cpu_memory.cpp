@@ -253,6 +253,13 @@ bool MemoryBlockWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
+        if (m_allocator) {
+            m_data = m_allocator->allocate(size, numa_node);
+            m_memUpperBound = size;
+            m_useExternalStorage = false;
+            return true;
+        }
+
         void* ptr = dnnl::impl::malloc(size, cacheLineSize);
         OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
         m_memUpperBound = size;
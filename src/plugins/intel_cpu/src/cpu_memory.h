@@ -18,6 +18,7 @@
 
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "memory_allocator.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -78,7 +79,13 @@ public:
  */
 class MemoryBlockWithReuse : public IMemoryBlock {
 public:
-    explicit MemoryBlockWithReuse(int numa_node = -1) : m_data(nullptr, release), numa_node(numa_node) {}
+    /**
+     * @param allocator allocates the memory bound to numa_node, the cache line aligned allocation is used if nullptr
+     */
+    explicit MemoryBlockWithReuse(int numa_node = -1, MemoryAllocatorPtr allocator = nullptr)
+        : m_data(nullptr, release),
+          numa_node(numa_node),
+          m_allocator(std::move(allocator)) {}
     [[nodiscard]] void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
@@ -89,8 +96,9 @@ public:
 private:
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0UL;
-    std::unique_ptr<void, void (*)(void*)> m_data;
+    MemoryAllocator::DataPtr m_data;
     int numa_node;
+    MemoryAllocatorPtr m_allocator;
 
     static void release(void* ptr);
     static void destroy(void* ptr);
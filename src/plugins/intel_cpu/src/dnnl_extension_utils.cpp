@@ -29,6 +29,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #if defined(OV_CPU_WITH_ACL) || defined(OPENVINO_ARCH_X86_64)
 #    include "utils/general_utils.h"
 #endif
@@ -306,4 +307,14 @@ std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<c
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+std::string DnnlExtensionUtils::computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                          const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    const auto src_desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*srcDesc->getDnnlDesc().get());
+    const auto dst_desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    const auto size = memory->getSize();
+    return std::to_string(src_desc_hash) + "_" + std::to_string(dst_desc_hash) + "_" + std::to_string(size) + "_" +
+           std::to_string(ov::runtime::compute_hash(memory->getData(), size));
+}
+
 }  // namespace ov::intel_cpu
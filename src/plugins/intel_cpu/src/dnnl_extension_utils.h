@@ -130,6 +130,18 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes the string hash identifying the repacked weights by the content of the original weights,
+     * so the identical weights of the different models get the same hash
+     * @param memory Weights memory pointer
+     * @param srcDesc descriptor defining weights representation before repacking
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string hash
+     */
+    static std::string computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                 const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
@@ -6,10 +6,12 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
 
 #include "cpu_memory.h"
+#include "memory_allocator.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "utils/general_utils.h"
 
@@ -19,16 +21,24 @@ class DnnlScratchPad {
     MemoryBlockPtr blockPtr;
     MemoryBlockWithReuse* baseBlockPtr = nullptr;
     dnnl::engine eng;
+    // the scratchpad memory objects are registered in the shared memory block, which is not thread safe, while the
+    // primitives of the independent nodes may be created concurrently (see Config::compilationThreads)
+    std::shared_ptr<std::mutex> memoryMutex = std::make_shared<std::mutex>();
 
 public:
-    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
-        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numa_node);
+    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1, MemoryAllocatorPtr allocator = nullptr)
+        : eng(std::move(eng)) {
+        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numa_node, std::move(allocator));
         baseBlockPtr = baseMemoryBlock.get();
         blockPtr = std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
-        return std::make_shared<Memory>(eng, md, blockPtr);
+        std::lock_guard<std::mutex> lock(*memoryMutex);
+        return {new Memory(eng, md, blockPtr), [memoryMutex = memoryMutex](Memory* mem) {
+                    std::lock_guard<std::mutex> lock(*memoryMutex);
+                    delete mem;
+                }};
     }
 
     [[nodiscard]] size_t size() const {
@@ -11,9 +11,11 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <deque>
 #include <exception>
 #include <functional>
@@ -52,6 +54,7 @@
 #include "nodes/input.h"
 #include "nodes/memory.hpp"
 #include "nodes/reorder.h"
+#include "nodes/subgraph.h"
 #include "nodes/tensoriterator.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -95,6 +98,114 @@ using namespace dnnl;
 
 namespace ov::intel_cpu {
 
+namespace {
+/**
+ * Accumulates the durations of the consecutive compilation phases of a graph
+ */
+class CompileTimer {
+public:
+    explicit CompileTimer(std::map<std::string, uint64_t>& times) : m_times(times) {}
+
+    /**
+     * Accounts the time passed since the previous phase as the time of the \p phase
+     */
+    void lap(const std::string& phase) {
+        const auto now = std::chrono::steady_clock::now();
+        m_times[phase] += std::chrono::duration_cast<std::chrono::microseconds>(now - m_start).count();
+        m_start = now;
+    }
+
+private:
+    std::map<std::string, uint64_t>& m_times;
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+};
+
+// the nodes having dependencies which are not expressed by the edges: the memory nodes are paired by the state id and
+// the nodes with the inner graphs share the graph context with the outer graph
+bool isCompiledSequentially(const NodePtr& node) {
+    return any_of(node->getType(),
+                  Type::MemoryInput,
+                  Type::MemoryOutput,
+                  Type::If,
+                  Type::TensorIterator,
+                  Type::SubModel,
+                  Type::LoRA,
+                  Type::Subgraph);
+}
+
+/**
+ * Splits the topologically sorted nodes into the waves of the nodes which do not depend on each other, so the nodes of
+ * a wave may be processed concurrently once all the previous waves are done. The sequentially compiled nodes form the
+ * single node waves which are never reordered with respect to any other node.
+ */
+std::vector<std::vector<NodePtr>> splitIntoWaves(const std::vector<NodePtr>& graphNodes) {
+    std::vector<std::vector<NodePtr>> waves;
+    std::unordered_map<const Node*, size_t> nodeWave;
+    size_t firstWave = 0;
+
+    for (const auto& node : graphNodes) {
+        if (isCompiledSequentially(node)) {
+            nodeWave[node.get()] = waves.size();
+            waves.push_back({node});
+            firstWave = waves.size();
+            continue;
+        }
+
+        size_t wave = firstWave;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto it = nodeWave.find(node->getParentEdgeAt(i)->getParent().get());
+            if (it != nodeWave.end()) {
+                wave = std::max(wave, it->second + 1);
+            }
+        }
+        nodeWave[node.get()] = wave;
+        if (wave == waves.size()) {
+            waves.emplace_back();
+        }
+        waves[wave].push_back(node);
+    }
+
+    return waves;
+}
+
+/**
+ * Applies \p func to the independent \p nodes using up to \p nthreads threads.
+ * The exception of the first failed node (in the order of \p nodes) is rethrown, so the error is the same
+ * as for the sequential processing regardless of the threads scheduling.
+ */
+template <typename F>
+void forEachNode(const std::vector<NodePtr>& nodes, int nthreads, const F& func) {
+    if (nthreads <= 1 || nodes.size() < 2) {
+        for (const auto& node : nodes) {
+            func(node);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nodes.size());
+    std::atomic<size_t> next{0};
+    parallel_nt(std::min(nthreads, static_cast<int>(nodes.size())), [&](const int, const int) {
+        for (size_t i = next++; i < nodes.size(); i = next++) {
+            try {
+                func(nodes[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+int getCompilationThreads(const Config& config) {
+    return std::min(config.compilationThreads, parallel_get_max_threads());
+}
+}  // namespace
+
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
     CPU_DEBUG_CAP_ENABLE(average_counters(*this));
@@ -376,7 +487,9 @@ void Graph::Init(const std::shared_ptr<const ov::Model>& model,
     m_context = context;
     m_stream = dnnl::stream(getEngine());
 
+    CompileTimer timer(m_compileTimes);
     Replicate(model, inputConfigs, outputConfigs);
+    timer.lap("Replicate");
 
     Configure();
 }
@@ -386,9 +499,12 @@ void Graph::Activate() {
     // the allocation context collection from the outer graph so the state for inner graph is "Ready"
     // We probably want to avoid such uncertancy
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
+    CompileTimer timer(m_compileTimes);
     Allocate();
+    timer.lap("Allocate");
 
     CreatePrimitivesAndExecConstants();
+    timer.lap("CreatePrimitivesAndExecConstants");
 
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
@@ -402,18 +518,23 @@ void Graph::Activate() {
 void Graph::Configure([[maybe_unused]] bool optimize) {
     OPENVINO_ASSERT(status == Status::NotReady, "Invalid graph status");
 
+    CompileTimer timer(m_compileTimes);
     SortTopologically();
     InitNodes();
+    timer.lap("InitNodes");
 
     ov::intel_cpu::GraphOptimizer::ApplyCommonGraphOptimizations(*this);
 
     SortTopologically();
+    timer.lap("ApplyCommonGraphOptimizations");
 
     InitDescriptors();
+    timer.lap("InitDescriptors");
 
     ResolveInplaceDirections();
 
     InitOptimalPrimitiveDescriptors();
+    timer.lap("InitOptimalPrimitiveDescriptors");
 
     ResolveEdgeConflicts();
 
@@ -423,6 +544,7 @@ void Graph::Configure([[maybe_unused]] bool optimize) {
     SortTopologically();
 
     ResolveComplexInplaceConflicts();
+    timer.lap("ResolveEdgeConflicts");
 
     ov::intel_cpu::GraphOptimizer::ApplyImplSpecificGraphOptimizations(*this);
 
@@ -431,6 +553,7 @@ void Graph::Configure([[maybe_unused]] bool optimize) {
     ResolveComplexInplaceConflicts();
 
     SortTopologically();
+    timer.lap("ApplyImplSpecificGraphOptimizations");
 
     status = Status::Initialized;
 }
@@ -445,14 +568,20 @@ void Graph::InitNodes() {
 void Graph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
 
-    for (auto& node : graphNodes) {
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
-        node->initSupportedPrimitiveDescriptors();
+    // the supported descriptors of a node depend on the node itself only, so the nodes are processed concurrently
+    auto initSupportedDescriptors = [](const NodePtr& node) {
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.getSupportedDescriptors);
+            DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE,
+                         itt::domains::intel_cpu_LT,
+                         node->profiling.initSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
+            node->initSupportedPrimitiveDescriptors();
+        }
 #ifdef CPU_DEBUG_CAPS
         {
             const auto& SPDs = node->getSupportedPrimitiveDescriptors();
@@ -470,9 +599,13 @@ void Graph::InitDescriptors() {
             }
         }
 #endif
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
-        node->filterSupportedPrimitiveDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE,
+                         itt::domains::intel_cpu_LT,
+                         node->profiling.filterSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
+            node->filterSupportedPrimitiveDescriptors();
+        }
 
 #ifdef CPU_DEBUG_CAPS
         const auto& SPDs = node->getSupportedPrimitiveDescriptors();
@@ -489,8 +622,20 @@ void Graph::InitDescriptors() {
                       SPDs[i]);
         }
 #endif
+    };
+
+    const auto nthreads = getCompilationThreads(getConfig());
+    if (nthreads <= 1) {
+        for (const auto& node : graphNodes) {
+            initSupportedDescriptors(node);
+        }
+    } else {
+        for (const auto& wave : splitIntoWaves(graphNodes)) {
+            forEachNode(wave, nthreads, initSupportedDescriptors);
+        }
     }
 
+    // the optimal descriptor is selected with respect to the selected descriptors of the parents
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
@@ -550,15 +695,15 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (const auto& node : graphNodes) {
-        {
-            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
-            DEBUG_LOG(*node);
-            node->createPrimitive();
-        }
+    auto createPrimitive = [](const NodePtr& node) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+        DEBUG_LOG(*node);
+        node->createPrimitive();
+    };
 
+    auto execConstant = [&](const NodePtr& node) {
         if (!node->isConstant() || !node->isExecutable()) {
-            continue;
+            return;
         }
 
         if (m_context->getWeightsCache()) {
@@ -574,6 +719,39 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         } else {
             ExecuteNodeWithCatch(node);
         }
+    };
+
+    const auto nthreads = getCompilationThreads(getConfig());
+    if (nthreads <= 1) {
+        for (const auto& node : graphNodes) {
+            createPrimitive(node);
+            execConstant(node);
+        }
+        return;
+    }
+
+    // The bodies of the snippets Subgraphs are lowered concurrently in advance, while their code is still generated
+    // in the sequential waves since the identical Subgraphs share the kernel executor table (see isCompiledSequentially)
+    std::vector<NodePtr> subgraphs;
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Type::Subgraph &&
+            std::static_pointer_cast<node::Subgraph>(node)->canBeLoweredConcurrently()) {
+            subgraphs.push_back(node);
+        }
+    }
+    forEachNode(subgraphs, nthreads, [](const NodePtr& node) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+        std::static_pointer_cast<node::Subgraph>(node)->lower();
+    });
+
+    // The primitives (including the weights repacking) of a wave are created concurrently once the constant inputs
+    // are computed by the previous waves. The constant nodes themselves are executed sequentially in the topological
+    // order, since the nodes of the stream share the same scratchpad memory.
+    for (const auto& wave : splitIntoWaves(graphNodes)) {
+        forEachNode(wave, nthreads, createPrimitive);
+        for (const auto& node : wave) {
+            execConstant(node);
+        }
     }
 }
 
@@ -893,6 +1071,12 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
 
+    if (getConfig().collectLatencyHistograms) {
+        for (const auto& node : m_executableGraphNodes) {
+            node->enableLatencyProfile();
+        }
+    }
+
     if (hasDynNodes) {
         status = Status::ReadyDynamic;
         // Here we use the following heuristic: if the number of sync nodes is less than 10 times of the number of exec
@@ -1593,6 +1777,7 @@ public:
 #define VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(ittScope, node, config) \
     VERBOSE(node, (config).debugCaps.verbose);                  \
     PERF(node, (config).collectPerfCounters);                   \
+    LATENCY((node)->getLatencyProfile(), execute);              \
     DUMP(node, (config).debugCaps, infer_count);                \
     OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);    \
     DEBUG_LOG(*(node));
@@ -1669,6 +1854,29 @@ void Graph::Infer(SyncInferRequest* request) {
     }
 }
 
+void Graph::WarmUp(const std::vector<ov::Shape>& inputShapes) {
+    OPENVINO_ASSERT(IsDynamic(), "Warm up is applicable only to a dynamic graph: ", GetName());
+    OPENVINO_ASSERT(inputShapes.size() == inputNodes.size(),
+                    "Unexpected number of input shapes for the warm up of the graph: ",
+                    GetName());
+
+    for (size_t i = 0; i < inputNodes.size(); ++i) {
+        const auto& inputNode = inputNodes[i];
+        if (inputNode->isDynamicNode()) {
+            inputNode->redefineOutputMemory({inputShapes[i]});
+        }
+        const auto& memory = inputNode->getChildEdgeAt(0)->getMemory();
+        OPENVINO_ASSERT(memory.getPrecision() != element::string,
+                        "Warm up is not supported for the string input: ",
+                        inputNode->getName());
+        if (memory.getSize() > 0) {
+            std::memset(memory.getData(), 0, memory.getSize());
+        }
+    }
+
+    Infer();
+}
+
 void Graph::SortTopologically() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SortTopologically");
 
@@ -1767,6 +1975,42 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
     }
 }
 
+void Graph::GetLatencyProfiles(std::vector<NodeLatencyRecord>& records) const {
+    for (const auto& node : m_executableGraphNodes) {
+        const auto* profile = node->getLatencyProfile();
+        if (!profile) {
+            continue;
+        }
+        records.push_back({node->getName(), node->getTypeStr(), node->getPrimitiveDescriptorType(), *profile});
+    }
+}
+
+size_t Graph::GetAllocatedMemorySize() const {
+    size_t size = m_context->getAuxiliaryNetworkMemoryControl()->allocatedSize();
+    for (const auto& scratchPad : m_context->getScratchPads()) {
+        size += scratchPad->size();
+    }
+    return size;
+}
+
+size_t Graph::GetConstantsMemorySize(std::unordered_set<const void*>& counted) const {
+    size_t size = 0;
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Type::Input || !node->isConstant()) {
+            continue;
+        }
+        const auto input = std::dynamic_pointer_cast<node::Input>(node);
+        if (!input || input->isConstMemoryCached()) {
+            continue;
+        }
+        const auto memory = input->getMemoryPtr();
+        if (memory && counted.insert(memory->getData()).second) {
+            size += memory->getSize();
+        }
+    }
+    return size;
+}
+
 void Graph::CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
     assert(parentPort >= 0 && childPort >= 0);
 
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -25,6 +26,7 @@
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "perf_count.h"
 #include "proxy_mem_blk.h"
 #include "utils/general_utils.h"
 
@@ -100,6 +102,14 @@ public:
 
     void Infer(SyncInferRequest* request = nullptr);
 
+    /**
+     * @brief Runs the dynamic graph once on zero filled inputs of the given shapes to build and cache the shape
+     * specialized executors in advance.
+     * @attention The input data is written into the graph input memory, so it must not be called once the graph input
+     * memory may have been bound to the external tensors of the infer requests.
+     */
+    void WarmUp(const std::vector<ov::Shape>& inputShapes);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -157,6 +167,33 @@ public:
 
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
 
+    /**
+     * @brief Appends the latency histograms of the executable nodes, collected if the CPU_LATENCY_HISTOGRAMS property
+     * is enabled
+     */
+    void GetLatencyProfiles(std::vector<NodeLatencyRecord>& records) const;
+
+    /**
+     * @brief Returns the size (in bytes) of the memory currently allocated for the intermediate tensors and the
+     * scratchpads of the graph. The weights are not included, since they are shared via the weights cache
+     */
+    size_t GetAllocatedMemorySize() const;
+
+    /**
+     * @brief Returns the size (in bytes) of the constants which are not held by the weights cache, i.e. the data of
+     * the model used in place and the clones owned by the graph
+     * @param counted the data of the constants already counted (e.g. by the other graphs sharing the same model data),
+     * is updated with the constants of the graph
+     */
+    size_t GetConstantsMemorySize(std::unordered_set<const void*>& counted) const;
+
+    /**
+     * @brief Returns the time (in microseconds) spent in the compilation phases of the graph
+     */
+    const std::map<std::string, uint64_t>& GetCompileTimeBreakdown() const {
+        return m_compileTimes;
+    }
+
     void CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort = 0, int childPort = 0);
     void RemoveEdge(const EdgePtr& edge);
     void RemoveDroppedNodes();
@@ -297,6 +334,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_compileTimes.clear();
     }
     Status status{Status::NotReady};
 
@@ -373,6 +411,8 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    std::map<std::string, uint64_t> m_compileTimes;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
 };
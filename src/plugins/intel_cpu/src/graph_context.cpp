@@ -11,6 +11,8 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "internal_properties.hpp"
+#include "memory_allocator.h"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
@@ -25,31 +27,46 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr sharedPrimitivesCache,
+                           KVCachePool::Ptr kvCachePool)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      // the independent nodes may be compiled concurrently, so the caches have to be thread safe in this case
+      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity, m_config.compilationThreads > 1)),
+      m_sharedPrimitivesCache(sharedPrimitivesCache ? std::move(sharedPrimitivesCache) : m_rtParamsCache),
+      m_snippetsParamsCache(
+          std::make_shared<MultiCache>(m_config.snippetsCacheCapacity, m_config.compilationThreads > 1)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
-      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
+      m_kvCachePool(std::move(kvCachePool)) {
+    // the NUMA node of the stream, -1 if the stream is not pinned to a node
+    int streamNumaNode = -1;
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
-        m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
+        streamNumaNode = m_cpuStreamExecutor ? m_cpuStreamExecutor->get_numa_node_id() : -1;
+        m_numaNodeId = std::max(0, streamNumaNode);
         auto nNumaNodes = get_num_numa_nodes();
         if (m_numNumaNodes < nNumaNodes) {
             m_numNumaNodes = nNumaNodes;
         }
     }
+    // by default the graph memory is placed by the first touch
+    int memoryNumaNode = -1;
+    if (m_config.memoryAllocationMode != MemoryAllocationMode::DEFAULT) {
+        m_memoryAllocator = std::make_shared<MemoryAllocator>(m_config.memoryAllocationMode);
+        memoryNumaNode = streamNumaNode;
+    }
+    m_auxiliaryNetworkMemoryControl = std::make_shared<NetworkMemoryControl>(m_memoryAllocator, memoryNumaNode);
+    m_memoryControl = m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main");
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
     int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
     for (int i = 0; i < numaNum; i++) {
-        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i, m_memoryAllocator));
     }
 }
 
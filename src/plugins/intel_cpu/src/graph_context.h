@@ -11,6 +11,8 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_pool.h"
+#include "memory_allocator.h"
 #include "memory_control.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -35,7 +37,9 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr sharedPrimitivesCache = nullptr,
+                 KVCachePool::Ptr kvCachePool = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -49,6 +53,16 @@ public:
         return m_rtParamsCache;
     }
 
+    /**
+     * @brief The cache of the immutable primitives, which may be executed concurrently by several streams: dnnl::reorder
+     * and DnnlExecutorLegacy (the stream and the scratchpad are passed on the execution). It may be shared between the
+     * streams of the same socket, so the executors keeping any mutable state (scratch buffers, own dnnl streams, post
+     * ops arguments) must be cached in getParamsCache() instead.
+     */
+    [[nodiscard]] MultiCachePtr getSharedPrimitivesCache() const {
+        return m_sharedPrimitivesCache;
+    }
+
     [[nodiscard]] MultiCachePtr getSnippetsParamsCache() const {
         return m_snippetsParamsCache;
     }
@@ -83,10 +97,21 @@ public:
         return m_memoryStatesRegister;
     }
 
+    [[nodiscard]] const KVCachePool::Ptr& getKVCachePool() const {
+        return m_kvCachePool;
+    }
+
     [[nodiscard]] const std::shared_ptr<MemoryControl>& getMemoryControl() const {
         return m_memoryControl;
     }
 
+    /**
+     * @return the allocator of the graph memory, nullptr if the default allocation is used
+     */
+    [[nodiscard]] const MemoryAllocatorPtr& getMemoryAllocator() const {
+        return m_memoryAllocator;
+    }
+
     [[nodiscard]] const std::shared_ptr<NetworkMemoryControl>& getAuxiliaryNetworkMemoryControl() const {
         return m_auxiliaryNetworkMemoryControl;
     }
@@ -108,8 +133,10 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache of the stream
     MultiCachePtr m_rtParamsCache;
+    // cache of the immutable primitives, may be shared between the streams of the same socket
+    MultiCachePtr m_sharedPrimitivesCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
@@ -128,11 +155,15 @@ private:
     int m_numaNodeId = 0;
 
     std::shared_ptr<node::MemoryStatesRegister> m_memoryStatesRegister;
+    // allocates the memory of the graph bound to the NUMA node of the stream (see Config::memoryAllocationMode)
+    MemoryAllocatorPtr m_memoryAllocator;
     // auxiliary object to allow creating additional memory control objects if the main one cannot be used
     // i.e. fallback graph for dynamic in-place
     std::shared_ptr<NetworkMemoryControl> m_auxiliaryNetworkMemoryControl;
     // main memory control object, which is supposed to be globally reused
     MemoryControl::Ptr m_memoryControl;
+    // plugin-wide pool of the KV cache memory of the states
+    KVCachePool::Ptr m_kvCachePool;
 };
 
 }  // namespace ov::intel_cpu
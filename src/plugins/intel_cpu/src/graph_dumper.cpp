@@ -24,6 +24,7 @@
 #include "cpu_types.h"
 #include "node.h"
 #include "nodes/scaled_attn.h"
+#include "nodes/subgraph.h"
 #include "onednn/dnnl.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -131,6 +132,13 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr& node) {
             serialization_info["kv_cache_precision"] = sdpa_node->getKVCachePrecision().get_type_name();
         }
     }
+    // record whether the snippets Subgraph body was lowered by the node or shared with an identical Subgraph
+    if (node->getType() == Type::Subgraph) {
+        auto* subgraph_node = dynamic_cast<ov::intel_cpu::node::Subgraph*>(node.get());
+        if (subgraph_node) {
+            serialization_info["lowered_body"] = subgraph_node->isLoweredBodyShared() ? "shared" : "own";
+        }
+    }
 
     return serialization_info;
 }
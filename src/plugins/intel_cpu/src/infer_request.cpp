@@ -23,7 +23,9 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "internal_properties.hpp"
 #include "itt.h"
+#include "kv_cache_pool.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -79,6 +81,13 @@ void SyncInferRequest::create_infer_request() {
 
     // create states according to the list of the MemoryStateNodes
     m_memory_states = m_compiled_model.graph().memoryStates();
+    for (const auto& state : m_memory_states) {
+        auto kv_cache_state = std::dynamic_pointer_cast<VariableStateKVcache>(state);
+        if (kv_cache_state && kv_cache_state->get_pool()) {
+            m_kv_cache_pool = kv_cache_state->get_pool();
+            m_kv_cache_states.push_back(kv_cache_state.get());
+        }
+    }
 }
 
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
@@ -92,6 +101,26 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+void SyncInferRequest::update_shape_profile() {
+    if (m_compiled_model.shape_profile_full()) {
+        return;
+    }
+    // report only the changes to avoid locking the shared profile on every inference
+    bool changed = false;
+    m_last_input_shapes.resize(m_input_ports_map.size());
+    for (const auto& input_port : m_input_ports_map) {
+        const auto& shape = get_tensor_ptr(input_port.second)->get_shape();
+        auto& last_shape = m_last_input_shapes[input_port.first];
+        if (last_shape != shape) {
+            last_shape = shape;
+            changed = true;
+        }
+    }
+    if (changed) {
+        m_compiled_model.record_input_shapes(m_last_input_shapes);
+    }
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -124,6 +153,7 @@ void SyncInferRequest::infer() {
 
     if (graph.hasDynamicInput()) {
         redefine_memory_for_input_nodes(graph);
+        update_shape_profile();
     }
 
     change_default_ptr(graph);
@@ -134,11 +164,18 @@ void SyncInferRequest::infer() {
     if (!m_memory_states.empty()) {
         graph.assignStates(m_memory_states);
     }
+    // the KV cache states may have been offloaded while the request was idle, they are restored and kept in memory
+    // until the inference is over
+    KVCachePool::Pin kv_cache_pin(m_kv_cache_pool, m_kv_cache_states);
 
     push_input_data(graph);
 
     graph.Infer(this);
 
+    if (graph._memoryLimit > 0) {
+        check_memory_limit(graph);
+    }
+
     throw_if_canceled();
 
     // update output control blocks, if any, in order to refresh internal buffers
@@ -151,6 +188,24 @@ void SyncInferRequest::infer() {
     graph.PullOutputData(m_outputs);
 }
 
+void SyncInferRequest::check_memory_limit(CompiledModel::GraphGuard& graph) const {
+    const auto allocated = graph.GetAllocatedMemorySize();
+    if (allocated <= graph._memoryLimit) {
+        return;
+    }
+    // the memory is released, so the footprint returns into the limit and the next inference allocates it again
+    graph.getGraphContext()->releaseMemory();
+    OPENVINO_THROW("The memory allocated by the inference of ",
+                   m_compiled_model.name(),
+                   " (",
+                   allocated,
+                   " bytes) exceeds the share of the stream in the limit set by ",
+                   ov::intel_cpu::max_memory.name(),
+                   " (",
+                   graph._memoryLimit,
+                   " bytes)");
+}
+
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
     auto&& graph = m_compiled_model.graph();
     OPENVINO_ASSERT(graph.IsReady(), "Graph is not ready!");
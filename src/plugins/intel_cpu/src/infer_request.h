@@ -15,6 +15,7 @@
 #include "cpu_shape.h"
 #include "cpu_tensor.h"
 #include "graph.h"
+#include "kv_cache_pool.h"
 #include "memory_state.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
@@ -112,8 +113,11 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    void update_shape_profile();
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
+    // fails the inference of the dynamic graph which has allocated more than its share of ov::intel_cpu::max_memory
+    void check_memory_limit(CompiledModel::GraphGuard& graph) const;
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
 
@@ -126,6 +130,10 @@ private:
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
+    // the KV cache states of m_memory_states, which are accounted in the plugin-wide pool
+    std::vector<VariableStateKVcache*> m_kv_cache_states;
+    KVCachePool::Ptr m_kv_cache_pool;
+    std::vector<ov::Shape> m_last_input_shapes;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
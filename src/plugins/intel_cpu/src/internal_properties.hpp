@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,150 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the immutable oneDNN primitives (the reorders and the primitives of SoftMax, LRN, Pooling,
+ * Deconvolution and RNN) compiled by one stream are reused by the other streams running on the same socket through a
+ * thread safe shared cache. The executors with the mutable scratch state are cached per stream anyway.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Read-only property to get the CPU runtime parameters cache usage counters accumulated over all the streams.
+ * The map contains the "hits", "misses" and "evictions" keys.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines the input shapes buckets the executors of a dynamic model are prebuilt for in the background right
+ * after the compilation. The buckets are separated by ';', each bucket lists the bracketed shapes of all the model
+ * inputs in the order of the model parameters, e.g. "[1,128][1,128];[1..8,1..512][1..8,1..512]".
+ * An interval dimension is expanded into its bounds and the powers of two between them. The interval dimensions with
+ * the same bounds within a bucket (e.g. the sequence length of several inputs) always take the same value.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Defines the limit (in bytes) of the KV cache memory of the stateful models, shared by all the infer requests
+ * of all the models compiled by the plugin. Once the limit is exceeded, the least recently used KV cache states of the
+ * idle requests are offloaded to a temporary file and restored by the next inference of their requests.
+ * 0 (default) means no limit. The property is plugin-wide, it is rejected by compile_model and import_model.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_memory_budget{"CPU_KV_CACHE_MEMORY_BUDGET"};
+
+/**
+ * @brief Defines the limit (in bytes) of the offloaded KV cache states. The states which do not fit the limit stay in
+ * memory, so the KV cache memory budget may be exceeded. 0 (default) means no limit.
+ * The property is plugin-wide, it is rejected by compile_model and import_model.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_offload_budget{"CPU_KV_CACHE_OFFLOAD_BUDGET"};
+
+/**
+ * @brief Defines the directory of the temporary file of the offloaded KV cache states. Empty (default) means the
+ * temporary directory of the system. The property is plugin-wide, it is rejected by compile_model and import_model.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> kv_cache_offload_dir{"CPU_KV_CACHE_OFFLOAD_DIR"};
+
+/**
+ * @brief Read-only property to get the time (in microseconds) spent in the compilation phases of the CPU graph, e.g.
+ * "InitDescriptors", "Allocate" or "CreatePrimitivesAndExecConstants". The time of the graph transformations is not
+ * included.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> compile_time_breakdown{
+    "CPU_COMPILE_TIME_BREAKDOWN"};
+
+/**
+ * @brief Enables the collection of the latency histograms of the graph nodes across the inferences: the execution, the
+ * shape inference and the preparation of the parameters of every node are recorded separately.
+ * The histograms are read with the latency_histograms_dump property of the compiled model.
+ */
+static constexpr Property<bool, PropertyMutability::RW> latency_histograms{"CPU_LATENCY_HISTOGRAMS"};
+
+/**
+ * @brief Enables the weight-only FullyConnected executor (x64, avx2 and newer) for the u8/i8/u4/i4 compressed weights
+ * with the group-wise decompression. It streams the compressed weights once per call instead of the dnnl
+ * decompression, and is taken only by the nodes whose number of rows is bounded by 8 (e.g. a decode-only model
+ * reshaped to the static batch), so it never keeps a second packing of the weights next to the dnnl one.
+ * Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> weight_only_fc{"CPU_WEIGHT_ONLY_FC"};
+
+/**
+ * @brief Read-only property to get the latency histograms of the nodes of the compiled model merged across its
+ * streams. The value is a ';' separated table with a header line, see dumpLatencyProfiles() for the format.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> latency_histograms_dump{"CPU_LATENCY_HISTOGRAMS_DUMP"};
+
+/**
+ * @brief Enum to define how the CPU plugin allocates the memory of the compiled model graphs.
+ */
+enum class MemoryAllocationMode : uint8_t {
+    DEFAULT = 0,                 //!<  Cache line aligned allocations, placed by the first touch
+    NUMA = 1,                    //!<  The allocations are bound to the NUMA node of the stream owning them
+    TRANSPARENT_HUGE_PAGES = 2,  //!<  NUMA, the large allocations are advised to use the transparent huge pages
+    HUGE_PAGES = 3,              //!<  NUMA, the large allocations are backed by the explicit (hugetlbfs) huge pages
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemoryAllocationMode& mode) {
+    switch (mode) {
+    case MemoryAllocationMode::DEFAULT:
+        return os << "DEFAULT";
+    case MemoryAllocationMode::NUMA:
+        return os << "NUMA";
+    case MemoryAllocationMode::TRANSPARENT_HUGE_PAGES:
+        return os << "TRANSPARENT_HUGE_PAGES";
+    case MemoryAllocationMode::HUGE_PAGES:
+        return os << "HUGE_PAGES";
+    default:
+        OPENVINO_THROW("Unsupported memory allocation mode value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemoryAllocationMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "DEFAULT") {
+        mode = MemoryAllocationMode::DEFAULT;
+    } else if (str == "NUMA") {
+        mode = MemoryAllocationMode::NUMA;
+    } else if (str == "TRANSPARENT_HUGE_PAGES") {
+        mode = MemoryAllocationMode::TRANSPARENT_HUGE_PAGES;
+    } else if (str == "HUGE_PAGES") {
+        mode = MemoryAllocationMode::HUGE_PAGES;
+    } else {
+        OPENVINO_THROW("Unsupported memory allocation mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines how the memory of the intermediate tensors, the inputs / outputs and the scratchpads of the compiled
+ * model is allocated. The huge pages are used for the allocations of at least one huge page only; if the explicit huge
+ * pages are exhausted, the transparent ones are used instead. The huge pages and the NUMA binding are supported on
+ * Linux only, the other systems use the default allocation. The allocation statistics are reported in the memory
+ * statistics dump of the compiled model (debug capabilities).
+ */
+static constexpr Property<MemoryAllocationMode, PropertyMutability::RW> memory_allocation_mode{
+    "CPU_MEMORY_ALLOCATION_MODE"};
+
+/**
+ * @brief Defines the limit (in bytes) of the memory of the compiled model: the weights and the intermediate tensors,
+ * the inputs / outputs and the scratchpads of the graphs of its streams. If the graphs of all the streams do not fit into
+ * the limit, the streams share the smaller number of graphs, i.e. the throughput is traded for the memory. The compilation
+ * fails if even a single graph does not fit. The graphs of the dynamic model allocate the memory of the shapes they are
+ * inferred with, so each of them gets an equal share of the limit left by the weights: the inference after which the
+ * graph exceeds its share fails and the memory of the graph is released. 0 (default) means no limit.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> max_memory{"CPU_MAX_MEMORY"};
+
+/**
+ * @brief Read-only property to get the peak memory (in bytes) of the compiled model predicted at the compilation time:
+ * the weights and the memory of all its graphs (see max_memory).
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> predicted_peak_memory{"CPU_PREDICTED_PEAK_MEMORY"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_offload_storage.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <string>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+#    include <cstdlib>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+std::FILE* openTemporaryFile(const std::filesystem::path& directory) {
+#ifdef _WIN32
+    static std::atomic<uint64_t> counter{0};
+    const auto path = directory / ("ov_kv_cache_" + std::to_string(_getpid()) + "_" + std::to_string(counter++));
+    // "T" keeps the file in the system cache as long as possible, "D" removes the file once it is closed
+    return _wfopen(path.c_str(), L"w+bTD");
+#else
+    int fd = -1;
+#    if defined(O_TMPFILE)
+    fd = open(directory.c_str(), O_TMPFILE | O_RDWR | O_EXCL, S_IRUSR | S_IWUSR);
+#    endif
+    if (fd < 0) {
+        // the file system does not support the unnamed files, the named one is unlinked right away
+        auto name = (directory / "ov_kv_cache_XXXXXX").string();
+        fd = mkstemp(name.data());
+        if (fd >= 0) {
+            unlink(name.c_str());
+        }
+    }
+    if (fd < 0) {
+        return nullptr;
+    }
+    auto* file = fdopen(fd, "w+b");
+    if (!file) {
+        close(fd);
+    }
+    return file;
+#endif
+}
+
+}  // namespace
+
+KVCacheOffloadStorage::KVCacheOffloadStorage(const std::string& directory) {
+    const auto path = directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(directory);
+    m_file = openTemporaryFile(path);
+    OPENVINO_ASSERT(m_file, "Failed to create the KV cache offload file in the directory ", path.string());
+}
+
+KVCacheOffloadStorage::~KVCacheOffloadStorage() {
+    std::fclose(m_file);
+}
+
+KVCacheOffloadStorage::Extent KVCacheOffloadStorage::allocate(size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Extent extent{m_fileSize, size};
+    // the first released extent which fits, the rest of it stays free
+    for (auto it = m_free.begin(); it != m_free.end(); ++it) {
+        if (it->second >= size) {
+            extent.offset = it->first;
+            if (it->second > size) {
+                m_free.emplace(it->first + size, it->second - size);
+            }
+            m_free.erase(it);
+            break;
+        }
+    }
+    if (extent.offset == m_fileSize) {
+        m_fileSize += size;
+    }
+    return extent;
+}
+
+void KVCacheOffloadStorage::release(const Extent& extent) {
+    if (extent.size == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_free.emplace(extent.offset, extent.size).first;
+    auto next = std::next(it);
+    if (next != m_free.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        m_free.erase(next);
+    }
+    if (it != m_free.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            m_free.erase(it);
+        }
+    }
+}
+
+void KVCacheOffloadStorage::write(const Extent& extent, size_t offset, const void* data, size_t size) {
+    OPENVINO_ASSERT(offset + size <= extent.size, "KV cache offload write is out of the extent");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    seek(extent.offset + offset);
+    OPENVINO_ASSERT(std::fwrite(data, 1, size, m_file) == size, "Failed to write the KV cache offload file");
+}
+
+void KVCacheOffloadStorage::read(const Extent& extent, size_t offset, void* data, size_t size) const {
+    OPENVINO_ASSERT(offset + size <= extent.size, "KV cache offload read is out of the extent");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    seek(extent.offset + offset);
+    OPENVINO_ASSERT(std::fread(data, 1, size, m_file) == size, "Failed to read the KV cache offload file");
+}
+
+void KVCacheOffloadStorage::seek(uint64_t offset) const {
+#ifdef _WIN32
+    const auto result = _fseeki64(m_file, static_cast<int64_t>(offset), SEEK_SET);
+#else
+    const auto result = fseeko(m_file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    OPENVINO_ASSERT(result == 0, "Failed to seek in the KV cache offload file");
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * The file backed storage of the offloaded KV cache states.
+ * The data are written to an unnamed temporary file, so the offloaded states neither take the memory of the process
+ * nor remain on the disk after the process exits. The space of the released extents is reused, the file is never
+ * shrunk. The offloaded bytes are budgeted by the KV cache pool.
+ *
+ * The class is thread safe
+ */
+class KVCacheOffloadStorage {
+public:
+    using Ptr = std::shared_ptr<KVCacheOffloadStorage>;
+
+    struct Extent {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    /**
+     * @param directory the directory of the temporary file, the system temporary directory is used if empty
+     */
+    explicit KVCacheOffloadStorage(const std::string& directory);
+    ~KVCacheOffloadStorage();
+
+    KVCacheOffloadStorage(const KVCacheOffloadStorage&) = delete;
+    KVCacheOffloadStorage& operator=(const KVCacheOffloadStorage&) = delete;
+
+    Extent allocate(size_t size);
+    void release(const Extent& extent);
+
+    void write(const Extent& extent, size_t offset, const void* data, size_t size);
+    void read(const Extent& extent, size_t offset, void* data, size_t size) const;
+
+private:
+    void seek(uint64_t offset) const;
+
+    // guards the file position and the free extents
+    mutable std::mutex m_mutex;
+    std::FILE* m_file = nullptr;
+    uint64_t m_fileSize = 0;
+    // offset -> size of the released extents, the adjacent ones are merged
+    std::map<uint64_t, uint64_t> m_free;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_pool.h"
+
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "memory_state.h"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+void KVCachePool::setBudget(uint64_t budget) {
+    m_budget = budget;
+    fitBudget();
+}
+
+uint64_t KVCachePool::getBudget() const {
+    return m_budget;
+}
+
+void KVCachePool::setOffloadBudget(uint64_t budget) {
+    m_offloadBudget = budget;
+}
+
+void KVCachePool::setOffloadDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (directory != m_offloadDirectory) {
+        m_offloadDirectory = directory;
+        m_offloadStorage.reset();
+    }
+}
+
+KVCachePool::Statistics KVCachePool::getStatistics() const {
+    Statistics statistics;
+    statistics.used_size = m_usedSize;
+    statistics.offloaded_size = m_offloadedSize;
+    statistics.offloads = m_offloads;
+    statistics.restores = m_restores;
+    return statistics;
+}
+
+void KVCachePool::registerState(VariableStateKVcache* state) {
+    state->pool_entry().lastUse = ++m_useCounter;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_states.insert(state);
+}
+
+void KVCachePool::unregisterState(VariableStateKVcache* state) {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // the victim is offloaded outside of the lock, so it must outlive the offloading
+        m_offloaded.wait(lock, [&] {
+            return m_offloading != state;
+        });
+        m_states.erase(state);
+    }
+    m_usedSize -= state->pool_entry().size.exchange(0);
+    m_offloadedSize -= state->pool_entry().offloadedSize.exchange(0);
+}
+
+void KVCachePool::acquire(const std::vector<VariableStateKVcache*>& states) {
+    // pin all the states first, so fitting the budget never offloads one of them while another one is accounted
+    for (auto* state : states) {
+        state->pool_entry().lastUse = ++m_useCounter;
+        if (state->pin()) {
+            m_restores++;
+        }
+    }
+    for (auto* state : states) {
+        account(state);
+    }
+    if (overBudget()) {
+        fitBudget();
+    }
+}
+
+void KVCachePool::release(const std::vector<VariableStateKVcache*>& states) {
+    for (auto* state : states) {
+        state->pool_entry().lastUse = ++m_useCounter;
+        state->unpin();
+    }
+    // the states of the request may have been the only ones over the budget
+    if (overBudget()) {
+        fitBudget();
+    }
+}
+
+void KVCachePool::update(VariableStateKVcache* state) {
+    account(state);
+    if (overBudget()) {
+        fitBudget();
+    }
+}
+
+void KVCachePool::account(VariableStateKVcache* state) {
+    const auto size = state->allocated_size();
+    const auto previous = state->pool_entry().size.exchange(size);
+    m_usedSize += size;
+    m_usedSize -= previous;
+    const auto offloadedSize = state->offloaded_size();
+    const auto previousOffloaded = state->pool_entry().offloadedSize.exchange(offloadedSize);
+    m_offloadedSize += offloadedSize;
+    m_offloadedSize -= previousOffloaded;
+}
+
+bool KVCachePool::overBudget() const {
+    const uint64_t budget = m_budget;
+    return budget != 0 && m_usedSize > budget;
+}
+
+void KVCachePool::fitBudget() {
+    std::unique_lock<std::mutex> fitLock(m_fitMutex, std::try_to_lock);
+    if (!fitLock.owns_lock()) {
+        // the budget is being fitted by another thread, which sees the size accounted by this one
+        return;
+    }
+    while (overBudget()) {
+        VariableStateKVcache* victim = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // the number of the states is moderate (two per attention layer of each request), so the least recently
+            // used one is simply searched for
+            uint64_t victimLastUse = 0;
+            for (auto* state : m_states) {
+                const auto& entry = state->pool_entry();
+                const uint64_t lastUse = entry.lastUse;
+                if (entry.pins == 0 && entry.size > 0 && (!victim || lastUse < victimLastUse)) {
+                    victim = state;
+                    victimLastUse = lastUse;
+                }
+            }
+            if (!victim) {
+                return;
+            }
+            m_offloading = victim;
+        }
+        // the offloaded bytes are only decreased by the other threads (by the restoring and the resetting of the
+        // states), so the available space is not overestimated
+        const uint64_t offloadBudget = m_offloadBudget;
+        const uint64_t offloadedSize = m_offloadedSize;
+        const uint64_t available = offloadBudget == 0 ? std::numeric_limits<uint64_t>::max()
+                                   : offloadBudget > offloadedSize ? offloadBudget - offloadedSize
+                                                                   : 0;
+        // the state may have been pinned since it was chosen, then it is skipped by the next iteration
+        auto status = VariableStateKVcache::OffloadStatus::Failed;
+        try {
+            status = victim->try_offload(getOffloadStorage(), available);
+        } catch (const std::exception& e) {
+            // the budget is soft, so the failed offloading (e.g. of the full disk) only keeps the states in memory
+            DEBUG_LOG("KVCachePool: offloading of the KV cache state failed: ", e.what());
+        }
+        if (status == VariableStateKVcache::OffloadStatus::Offloaded) {
+            account(victim);
+            m_offloads++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_offloading = nullptr;
+        }
+        m_offloaded.notify_all();
+        if (status == VariableStateKVcache::OffloadStatus::Failed) {
+            // the least recently used state does not fit the offload budget or the storage failed, the more recent
+            // ones are kept in memory as well
+            return;
+        }
+    }
+}
+
+KVCacheOffloadStorage::Ptr KVCachePool::getOffloadStorage() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_offloadStorage) {
+        m_offloadStorage = std::make_shared<KVCacheOffloadStorage>(m_offloadDirectory);
+    }
+    return m_offloadStorage;
+}
+
+KVCachePool::Pin::Pin(Ptr pool, const std::vector<VariableStateKVcache*>& states)
+    : m_pool(std::move(pool)),
+      m_states(states) {
+    if (m_pool && !m_states.empty()) {
+        m_pool->acquire(m_states);
+    }
+}
+
+KVCachePool::Pin::~Pin() {
+    if (m_pool && !m_states.empty()) {
+        m_pool->release(m_states);
+    }
+}
+
+}  // namespace ov::intel_cpu
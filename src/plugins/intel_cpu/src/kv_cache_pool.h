@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "kv_cache_offload_storage.h"
+
+namespace ov::intel_cpu {
+
+class VariableStateKVcache;
+
+/**
+ * The plugin-wide pool of the KV cache memory of the stateful SDPA models.
+ * Every KV cache state of every infer request is accounted in the pool. Once the memory of the states exceeds the
+ * budget, the least recently used idle states (i.e. the states of the requests which are not running) are offloaded:
+ * their valid tokens (without the growth reserve) are written to the file backed offload storage and the KV cache
+ * memory is released. The offloaded state is restored transparently by the next inference of its request, so the
+ * budget bounds the memory of the active conversations rather than of all the open ones.
+ * The budget is soft: the states of the running requests are never offloaded, even if they alone exceed the budget.
+ * The offloaded bytes are limited by their own budget, the states which do not fit it stay in memory.
+ *
+ * The accounting is lock free, the pool mutex is taken only to search for the victim when the budget is exceeded, and
+ * the data are copied outside of it. So the inferences do not contend on the pool unless the budget is set.
+ *
+ * Is a thread safe
+ */
+class KVCachePool {
+public:
+    using Ptr = std::shared_ptr<KVCachePool>;
+
+    struct Statistics {
+        uint64_t used_size = 0;       // bytes of the KV cache memory of the states
+        uint64_t offloaded_size = 0;  // bytes of the offloaded states in the offload storage
+        uint64_t offloads = 0;
+        uint64_t restores = 0;
+    };
+
+    /**
+     * The accounting of a state in the pool, is owned by the state
+     */
+    struct Entry {
+        std::atomic<size_t> size{0};
+        std::atomic<size_t> offloadedSize{0};
+        std::atomic<size_t> pins{0};
+        std::atomic<uint64_t> lastUse{0};
+    };
+
+    /**
+     * @param budget the limit of the KV cache memory in bytes, 0 means no limit
+     * @param offloadBudget the limit of the offloaded KV cache states in bytes, 0 means no limit
+     */
+    explicit KVCachePool(uint64_t budget = 0, uint64_t offloadBudget = 0)
+        : m_budget(budget),
+          m_offloadBudget(offloadBudget) {}
+
+    void setBudget(uint64_t budget);
+    uint64_t getBudget() const;
+    void setOffloadBudget(uint64_t budget);
+    /**
+     * Sets the directory of the offload file, the system temporary directory is used if empty. The states offloaded
+     * before stay in the previous file until they are restored.
+     */
+    void setOffloadDirectory(const std::string& directory);
+    Statistics getStatistics() const;
+
+    void registerState(VariableStateKVcache* state);
+    void unregisterState(VariableStateKVcache* state);
+
+    /**
+     * Marks the states as used by the running inference: restores the offloaded ones and protects all of them from the
+     * offloading until they are released
+     */
+    void acquire(const std::vector<VariableStateKVcache*>& states);
+    void release(const std::vector<VariableStateKVcache*>& states);
+
+    /**
+     * Accounts the new size of the state memory, offloads the idle states if the budget is exceeded
+     */
+    void update(VariableStateKVcache* state);
+    /**
+     * Accounts the new size of the state memory without fitting the budget, e.g. while the state is being reset
+     */
+    void refresh(VariableStateKVcache* state) {
+        account(state);
+    }
+
+    /**
+     * Keeps the states acquired for the lifetime of the object
+     */
+    class Pin {
+    public:
+        Pin(Ptr pool, const std::vector<VariableStateKVcache*>& states);
+        ~Pin();
+
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+
+    private:
+        Ptr m_pool;
+        const std::vector<VariableStateKVcache*>& m_states;
+    };
+
+private:
+    void account(VariableStateKVcache* state);
+    bool overBudget() const;
+    void fitBudget();
+    KVCacheOffloadStorage::Ptr getOffloadStorage();
+
+    std::atomic<uint64_t> m_budget{0};
+    std::atomic<uint64_t> m_offloadBudget{0};
+    std::atomic<uint64_t> m_usedSize{0};
+    std::atomic<uint64_t> m_offloadedSize{0};
+    std::atomic<uint64_t> m_useCounter{0};
+    std::atomic<uint64_t> m_offloads{0};
+    std::atomic<uint64_t> m_restores{0};
+
+    // guards the registry of the states, the state being offloaded and the offload storage
+    mutable std::mutex m_mutex;
+    std::condition_variable m_offloaded;
+    std::unordered_set<VariableStateKVcache*> m_states;
+    VariableStateKVcache* m_offloading = nullptr;
+    // is created by the first offloading
+    KVCacheOffloadStorage::Ptr m_offloadStorage;
+    std::string m_offloadDirectory;
+    // only one thread fits the budget at a time, the others do not wait for it
+    std::mutex m_fitMutex;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_allocator.h"
+
+#include <atomic>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "internal_properties.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#    include <cstring> /* strerror(errno) */
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+
+void updatePeak(std::atomic<uint64_t>& peak, uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+bool bindToNuma([[maybe_unused]] MemoryAllocationMode mode) {
+#if defined(__linux__)
+    // the binding makes no difference on a single node system
+    return mode != MemoryAllocationMode::DEFAULT && get_num_numa_nodes() > 1;
+#else
+    // mbind is not available
+    return false;
+#endif
+}
+
+}  // namespace
+
+MemoryAllocator::MemoryAllocator(MemoryAllocationMode mode) : m_mode(mode), m_bindToNuma(bindToNuma(mode)) {}
+
+MemoryAllocator::DataPtr MemoryAllocator::allocate(size_t size, int numaNode) {
+    enum class Backing : uint8_t { Regular, TransparentHugePages, HugePages };
+
+    auto backing = Backing::Regular;
+    size_t allocSize = size;
+    void* ptr = nullptr;
+#if defined(__linux__)
+    const bool useHugePages =
+        any_of(m_mode, MemoryAllocationMode::TRANSPARENT_HUGE_PAGES, MemoryAllocationMode::HUGE_PAGES);
+    if (useHugePages && size >= hugePageSize) {
+        allocSize = rnd_up(size, hugePageSize);
+        if (m_mode == MemoryAllocationMode::HUGE_PAGES) {
+            // without MAP_NORESERVE the mapping fails right away if the huge pages pool cannot back it
+            ptr = mmap(nullptr, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr == MAP_FAILED) {
+                DEBUG_LOG("MemoryAllocator: huge pages mmap of ", allocSize, " bytes failed: ", strerror(errno));
+                ptr = nullptr;
+                m_counters->hugePagesFallbacks++;
+            } else {
+                backing = Backing::HugePages;
+            }
+        }
+        if (ptr == nullptr) {
+            ptr = dnnl::impl::malloc(allocSize, hugePageSize);
+            OPENVINO_ASSERT(ptr, "Failed to allocate ", allocSize, " bytes of memory");
+            if (madvise(ptr, allocSize, MADV_HUGEPAGE) != 0) {
+                DEBUG_LOG("MemoryAllocator: madvise(MADV_HUGEPAGE) failed: ", strerror(errno));
+            }
+            backing = Backing::TransparentHugePages;
+        }
+    }
+#endif
+    // mbind applies to the whole pages, so only the allocations owning their pages are bound: otherwise the binding
+    // would move the neighbouring data sharing the first and the last page
+    bool bindable = backing != Backing::Regular;
+#if defined(__linux__)
+    if (ptr == nullptr && m_bindToNuma && numaNode >= 0) {
+        const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        if (size >= pageSize) {
+            allocSize = rnd_up(size, pageSize);
+            ptr = dnnl::impl::malloc(allocSize, pageSize);
+            OPENVINO_ASSERT(ptr, "Failed to allocate ", allocSize, " bytes of memory");
+            bindable = true;
+        }
+    }
+#endif
+    if (ptr == nullptr) {
+        ptr = dnnl::impl::malloc(allocSize, cacheLineSize);
+        OPENVINO_ASSERT(ptr, "Failed to allocate ", allocSize, " bytes of memory");
+    }
+
+    // the memory is not touched yet, so the binding places the pages instead of migrating them
+    bool bound = false;
+    if (m_bindToNuma && numaNode >= 0 && bindable) {
+        bound = mbind_move(ptr, allocSize, numaNode);
+        if (!bound) {
+            DEBUG_LOG("MemoryAllocator: binding of ", allocSize, " bytes to node ", numaNode, " failed");
+            m_counters->numaBindFailures++;
+        }
+    }
+
+    auto& counters = *m_counters;
+    counters.allocations++;
+    updatePeak(counters.peakAllocatedSize, counters.allocatedSize += allocSize);
+    if (backing == Backing::HugePages) {
+        counters.hugePagesSize += allocSize;
+    } else if (backing == Backing::TransparentHugePages) {
+        counters.transparentHugePagesSize += allocSize;
+    }
+    if (bound) {
+        counters.numaBoundSize += allocSize;
+    }
+
+    return {ptr, [countersPtr = m_counters, allocSize, backing, bound](void* data) {
+                auto& counters = *countersPtr;
+                counters.allocatedSize -= allocSize;
+                if (bound) {
+                    counters.numaBoundSize -= allocSize;
+                }
+#if defined(__linux__)
+                if (backing == Backing::HugePages) {
+                    counters.hugePagesSize -= allocSize;
+                    munmap(data, allocSize);
+                    return;
+                }
+#endif
+                if (backing == Backing::TransparentHugePages) {
+                    counters.transparentHugePagesSize -= allocSize;
+                }
+                dnnl::impl::free(data);
+            }};
+}
+
+MemoryAllocator::Statistics MemoryAllocator::getStatistics() const {
+    const auto& counters = *m_counters;
+    Statistics statistics;
+    statistics.allocations = counters.allocations;
+    statistics.allocated_size = counters.allocatedSize;
+    statistics.peak_allocated_size = counters.peakAllocatedSize;
+    statistics.huge_pages_size = counters.hugePagesSize;
+    statistics.transparent_huge_pages_size = counters.transparentHugePagesSize;
+    statistics.huge_pages_fallbacks = counters.hugePagesFallbacks;
+    statistics.numa_bound_size = counters.numaBoundSize;
+    statistics.numa_bind_failures = counters.numaBindFailures;
+    return statistics;
+}
+
+}  // namespace ov::intel_cpu
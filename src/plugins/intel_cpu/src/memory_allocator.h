@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "internal_properties.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * The allocator of the graph memory blocks of a compiled model (see MemoryAllocationMode).
+ * The allocations of at least one page are page aligned and bound to the requested NUMA node before the first touch,
+ * so the pages are created on that node instead of the node of the thread which touches them first. The smaller
+ * allocations share their pages with other data and are not bound. The allocations of at least one huge page are backed by
+ * the huge pages to reduce the TLB misses on the large activations and the scratchpads, the smaller ones use the
+ * regular cache line aligned allocation.
+ *
+ * Is a thread safe
+ */
+class MemoryAllocator {
+public:
+    using Ptr = std::shared_ptr<MemoryAllocator>;
+    using DataPtr = std::unique_ptr<void, std::function<void(void*)>>;
+
+    static constexpr size_t hugePageSize = 2UL << 20;
+
+    struct Statistics {
+        uint64_t allocations = 0;
+        uint64_t allocated_size = 0;               // bytes currently allocated
+        uint64_t peak_allocated_size = 0;          // bytes
+        uint64_t huge_pages_size = 0;              // bytes currently backed by the explicit huge pages
+        uint64_t transparent_huge_pages_size = 0;  // bytes currently advised to use the transparent huge pages
+        uint64_t huge_pages_fallbacks = 0;         // explicit huge pages allocations served by the transparent ones
+        uint64_t numa_bound_size = 0;              // bytes currently bound to a NUMA node
+        uint64_t numa_bind_failures = 0;
+    };
+
+    explicit MemoryAllocator(MemoryAllocationMode mode);
+
+    [[nodiscard]] MemoryAllocationMode getMode() const {
+        return m_mode;
+    }
+
+    /**
+     * @param numaNode the logical NUMA node to bind the memory to, -1 means no binding
+     */
+    DataPtr allocate(size_t size, int numaNode);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> allocatedSize{0};
+        std::atomic<uint64_t> peakAllocatedSize{0};
+        std::atomic<uint64_t> hugePagesSize{0};
+        std::atomic<uint64_t> transparentHugePagesSize{0};
+        std::atomic<uint64_t> hugePagesFallbacks{0};
+        std::atomic<uint64_t> numaBoundSize{0};
+        std::atomic<uint64_t> numaBindFailures{0};
+    };
+
+    const MemoryAllocationMode m_mode;
+    const bool m_bindToNuma;
+    // the blocks may outlive the allocator (e.g. the memory owned by the tensors), so the counters are shared with them
+    std::shared_ptr<Counters> m_counters = std::make_shared<Counters>();
+};
+
+using MemoryAllocatorPtr = MemoryAllocator::Ptr;
+
+}  // namespace ov::intel_cpu
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_allocator.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -63,8 +64,8 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
-        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
+    MemoryBlockWithRelease(const MemoryAllocatorPtr& allocator, int numaNode) {
+        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>(numaNode, allocator);
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
     }
@@ -154,6 +155,7 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    [[nodiscard]] virtual size_t allocatedSize() const = 0;
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -172,9 +174,13 @@ class MemoryManagerIO : public IMemoryManager {
 public:
     using BlockType = MemoryBlockWithReuse;
 
+    MemoryManagerIO(MemoryAllocatorPtr allocator, int numaNode)
+        : m_allocator(std::move(allocator)),
+          m_numaNode(numaNode) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
-        auto block = std::make_unique<BlockType>();
-        CPU_DEBUG_CAP_ENABLE(m_blocks.emplace_back(*block);)
+        auto block = std::make_unique<BlockType>(m_numaNode, m_allocator);
+        m_blocks.emplace_back(*block);
         m_solution.insert({reg.id, makeDnnlMemoryBlock(std::move(block))});
     }
 
@@ -188,6 +194,15 @@ public:
     void release() override {
         // nothing to do
     }
+    [[nodiscard]] size_t allocatedSize() const override {
+        // the blocks bound to the user tensors do not own the memory
+        return std::accumulate(m_blocks.begin(),
+                               m_blocks.end(),
+                               static_cast<size_t>(0),
+                               [](size_t acc, const BlockType& item) {
+                                   return acc + (item.hasExtBuffer() ? 0 : item.size());
+                               });
+    }
 
 private:
     static const char* getClassName() {
@@ -195,12 +210,18 @@ private:
     }
 
     MemoryControl::MemorySolution m_solution;
-    CPU_DEBUG_CAP_ENABLE(std::vector<std::reference_wrapper<BlockType>> m_blocks;)
+    MemoryAllocatorPtr m_allocator;
+    int m_numaNode;
+    std::vector<std::reference_wrapper<BlockType>> m_blocks;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj);)
 };
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    MemoryManagerStatic(MemoryAllocatorPtr allocator, int numaNode)
+        : m_allocator(std::move(allocator)),
+          m_numaNode(numaNode) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -226,7 +247,7 @@ private:
         ov::MemorySolver staticMemSolver(boxes_to_process);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        m_workspace = std::make_shared<MemoryBlockWithRelease>(m_allocator, m_numaNode);
 
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
@@ -245,6 +266,9 @@ private:
             m_workspace->free();
         }
     }
+    [[nodiscard]] size_t allocatedSize() const override {
+        return m_workspace ? m_workspace->size() : 0;
+    }
 
     static const char* getClassName() {
         return "MemoryManagerStatic";
@@ -255,11 +279,17 @@ private:
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
     size_t m_totalSize = 0;
     bool reset_flag = true;
+    MemoryAllocatorPtr m_allocator;
+    int m_numaNode;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    MemoryManagerNonOverlappingSets(MemoryAllocatorPtr allocator, int numaNode)
+        : m_allocator(std::move(allocator)),
+          m_numaNode(numaNode) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -296,11 +326,17 @@ private:
     static std::shared_ptr<InternalBlock> internalBlock(const std::shared_ptr<MemoryBlockWithRelease>& block) {
         return std::make_shared<InternalBlock>(block);
     }
+    static const MemoryBlockWithRelease* uniqueBlock(const InternalBlock& block) {
+        return block.getParentBlock().get();
+    }
 #else
     using InternalBlock = MemoryBlockWithRelease;
     std::shared_ptr<InternalBlock> internalBlock(const std::shared_ptr<MemoryBlockWithRelease>& block) {
         return block;
     }
+    static const MemoryBlockWithRelease* uniqueBlock(const InternalBlock& block) {
+        return &block;
+    }
 #endif  // CPU_DEBUG_CAPS
 
     void solve() {
@@ -325,7 +361,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_allocator, m_numaNode);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -340,6 +376,19 @@ private:
             item.second->free();
         }
     }
+    [[nodiscard]] size_t allocatedSize() const override {
+        // the boxes of a group share the block
+        std::unordered_set<const MemoryBlockWithRelease*> uniqueBlocks;
+        for (auto&& item : m_internalBlocks) {
+            uniqueBlocks.insert(uniqueBlock(*item.second));
+        }
+        return std::accumulate(uniqueBlocks.begin(),
+                               uniqueBlocks.end(),
+                               static_cast<size_t>(0),
+                               [](size_t acc, const MemoryBlockWithRelease* block) {
+                                   return acc + block->size();
+                               });
+    }
 
     static const char* getClassName() {
         return "MemoryManagerNonOverlappingSets";
@@ -349,6 +398,8 @@ private:
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
     bool reset_flag = true;
+    MemoryAllocatorPtr m_allocator;
+    int m_numaNode;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
 
@@ -479,6 +530,10 @@ public:
         m_memManager->release();
     }
 
+    [[nodiscard]] size_t allocatedSize() const {
+        return m_memManager->allocatedSize();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -517,23 +572,33 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, const MemoryAllocatorPtr& allocator, int numaNode)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        allocator,
+        numaNode));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        allocator,
+        numaNode));
 
     // handler for I/O tensors, so far simply individual blocks
-    m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
-        return MemoryRegion::RegionType::VARIABLE != reg.type && reg.alloc_type == MemoryRegion::AllocType::POD;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerIO>(
+        [](const MemoryRegion& reg) {
+            return MemoryRegion::RegionType::VARIABLE != reg.type && reg.alloc_type == MemoryRegion::AllocType::POD;
+        },
+        allocator,
+        numaNode));
 }
 
 void MemoryControl::insert(const MemoryRegion& region, const std::vector<size_t>& syncInds) {
@@ -579,6 +644,15 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+size_t MemoryControl::allocatedSize() const {
+    return std::accumulate(m_handlers.begin(),
+                           m_handlers.end(),
+                           static_cast<size_t>(0),
+                           [](size_t acc, const RegionHandlerPtr& handler) {
+                               return acc + handler->allocatedSize();
+                           });
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -590,7 +664,8 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_allocator, m_numaNode)));
     return m_controlUnits.back();
 }
 
@@ -606,6 +681,15 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+size_t NetworkMemoryControl::allocatedSize() const {
+    return std::accumulate(m_controlUnits.begin(),
+                           m_controlUnits.end(),
+                           static_cast<size_t>(0),
+                           [](size_t acc, const MemoryControl::Ptr& unit) {
+                               return acc + unit->allocatedSize();
+                           });
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
@@ -14,6 +14,7 @@
 
 #include "cpu_memory.h"
 #include "edge.h"
+#include "memory_allocator.h"
 
 namespace ov::intel_cpu {
 
@@ -66,8 +67,13 @@ public:
         return m_id;
     }
 
+    /**
+     * @return the size (in bytes) of the memory currently allocated by the unit
+     */
+    [[nodiscard]] size_t allocatedSize() const;
+
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, const MemoryAllocatorPtr& allocator, int numaNode);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -81,11 +87,20 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
+    /**
+     * @param allocator allocates the memory of the control units bound to numaNode, the default allocation if nullptr
+     */
+    NetworkMemoryControl(MemoryAllocatorPtr allocator, int numaNode)
+        : m_allocator(std::move(allocator)),
+          m_numaNode(numaNode) {}
+
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
     void releaseMemory();
 
+    [[nodiscard]] size_t allocatedSize() const;
+
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
@@ -94,6 +109,8 @@ public:
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    MemoryAllocatorPtr m_allocator;
+    int m_numaNode = -1;
 };
 
 }  // namespace ov::intel_cpu
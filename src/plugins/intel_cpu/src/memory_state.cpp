@@ -9,7 +9,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <utility>
@@ -19,6 +21,7 @@
 #include "cpu_tensor.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "kv_cache_pool.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -226,26 +229,55 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           KVCachePool::Ptr pool)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_pool(std::move(pool)) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
+    if (m_pool) {
+        m_pool->registerState(this);
+    }
+}
+
+VariableStateKVcache::~VariableStateKVcache() {
+    if (m_pool) {
+        m_pool->unregisterState(this);
+    }
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    drop_offloaded();
 }
 
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    if (m_offload_storage) {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        PlainTensor scale_zp;
+        read_offloaded(internal_mem, hidden_state, scale_zp);
+        return std::make_shared<Tensor>(
+            dense_copy(get_external_desc()->getPrecision(), internal_mem, hidden_state, scale_zp));
+    }
     if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
         return std::make_shared<Tensor>(external_mem);
     }
+    return std::make_shared<Tensor>(
+        dense_copy(get_external_desc()->getPrecision(), m_internal_mem, m_hidden_state, m_scale_zp));
+}
 
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+MemoryPtr VariableStateKVcache::dense_copy(const ov::element::Type& precision,
+                                           const MemoryPtr& internal_mem,
+                                           const MemoryPtr& hidden_state,
+                                           const PlainTensor& scale_zp) const {
+    auto actual_internal_desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
-    auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
+    auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims)->cloneWithNewPrecision(precision);
     auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
 
     // let's assume 4th rank KV tensors. This may be extended later
@@ -260,8 +292,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
+    beam_table.reset(hidden_state);
+    pastkv.reset(internal_mem);
     output = output.permute(actual_internal_order);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
@@ -284,8 +316,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                                            S,
                                            pastkv.m_strides[2],
                                            S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                                           scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                           scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
@@ -296,7 +328,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                     attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
                                     buffers[ithr].ptr<float>() + group_id * m_group_size,
                                     m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                                    scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -308,10 +340,19 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
         });
     }
 
-    return std::make_shared<Tensor>(external_mem);
+    return external_mem;
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    {
+        std::lock_guard<std::mutex> lock(m_offload_mutex);
+        drop_offloaded();
+        load_state(state);
+    }
+    update_pool();
+}
+
+void VariableStateKVcache::load_state(const ov::SoPtr<ov::ITensor>& state) {
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -397,7 +438,14 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    {
+        std::lock_guard<std::mutex> lock(m_offload_mutex);
+        drop_offloaded();
+    }
+    // the state is not marked as reset yet, so it must not be offloaded by fitting the budget here
+    if (m_pool) {
+        m_pool->refresh(this);
+    }
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -431,4 +479,183 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+size_t VariableStateKVcache::allocated_size() const {
+    return m_internal_mem_max_size * m_dense_internal_desc->getPrecision().size() +
+           m_hidden_state_max_size * sizeof(int32_t) + m_scale_zp.m_capacity;
+}
+
+size_t VariableStateKVcache::offloaded_size() const {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    return m_offload_storage ? m_offloaded.size : 0;
+}
+
+bool VariableStateKVcache::is_offloaded() const {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    return m_offload_storage != nullptr;
+}
+
+bool VariableStateKVcache::pin() {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    m_pool_entry.pins++;
+    if (!m_offload_storage) {
+        return false;
+    }
+    restore();
+    return true;
+}
+
+void VariableStateKVcache::unpin() {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    m_pool_entry.pins--;
+}
+
+VariableStateKVcache::OffloadStatus VariableStateKVcache::try_offload(const KVCacheOffloadStorage::Ptr& storage,
+                                                                      uint64_t available) {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    if (m_pool_entry.pins > 0) {
+        return OffloadStatus::Pinned;
+    }
+    return offload(storage, available) ? OffloadStatus::Offloaded : OffloadStatus::Failed;
+}
+
+bool VariableStateKVcache::offload(const KVCacheOffloadStorage::Ptr& storage, uint64_t available) {
+    if (m_offload_storage) {
+        return true;
+    }
+    if (m_internal_mem && m_hidden_state && !is_reset_state()) {
+        // only the growth reserve is dropped, the data are written as is: the beam table is not applied and the u8
+        // cache keeps its scales and zero points
+        PlainTensor pastkv;
+        pastkv.reset(m_internal_mem);
+        pastkv = pastkv.permute(m_dense_internal_desc->getOrder());
+        const auto L0 = pastkv.size(0);
+        const auto B = pastkv.size(1);
+        const auto H = pastkv.size(2);
+        const auto S = pastkv.size(3);
+        VectorDims scale_zp_dims;
+        const size_t kv_size = L0 * B * H * S * pastkv.m_element_size;
+        const size_t beam_table_size = B * L0 * sizeof(int32_t);
+        size_t scale_zp_size = 0;
+        if (m_dense_internal_desc->getPrecision() == element::u8) {
+            // by channel: [group_nums * 2, B, H, S], otherwise: [L, B, H, 2 * S / group_size]
+            scale_zp_dims = {m_quant_by_channel ? div_up(L0, m_group_size) * 2 : L0,
+                             m_scale_zp.size(1),
+                             m_scale_zp.size(2),
+                             m_scale_zp.size(3)};
+            scale_zp_size = sizeof(float) * scale_zp_dims[0] * scale_zp_dims[1] * scale_zp_dims[2] * scale_zp_dims[3];
+        }
+        const size_t size = kv_size + beam_table_size + scale_zp_size;
+        if (size > available) {
+            return false;
+        }
+
+        const auto extent = storage->allocate(size);
+        try {
+            // the rows of a token are gathered into one write, the growth reserve is skipped
+            std::vector<uint8_t> buffer(B * H * S * pastkv.m_element_size);
+            const size_t row_size = S * pastkv.m_element_size;
+            for (size_t m = 0; m < L0; m++) {
+                parallel_for2d(B, H, [&](size_t b, size_t h) {
+                    std::memcpy(buffer.data() + (b * H + h) * row_size, pastkv.ptr_v(m, b, h), row_size);
+                });
+                storage->write(extent, m * buffer.size(), buffer.data(), buffer.size());
+            }
+
+            PlainTensor beam_table;
+            beam_table.reset(m_hidden_state);
+            for (size_t b = 0; b < B; b++) {
+                storage->write(extent,
+                               kv_size + b * L0 * sizeof(int32_t),
+                               beam_table.ptr<int32_t>(b),
+                               L0 * sizeof(int32_t));
+            }
+
+            if (scale_zp_size) {
+                const size_t row_size = sizeof(float) * scale_zp_dims[3];
+                const size_t rows = scale_zp_dims[1] * scale_zp_dims[2];
+                std::vector<float> scale_zp_buffer(rows * scale_zp_dims[3]);
+                for (size_t r = 0; r < scale_zp_dims[0]; r++) {
+                    parallel_for2d(scale_zp_dims[1], scale_zp_dims[2], [&](size_t b, size_t h) {
+                        std::memcpy(scale_zp_buffer.data() + (b * scale_zp_dims[2] + h) * scale_zp_dims[3],
+                                    m_scale_zp.ptr<float>(r, b, h),
+                                    row_size);
+                    });
+                    storage->write(extent,
+                                   kv_size + beam_table_size + r * rows * row_size,
+                                   scale_zp_buffer.data(),
+                                   rows * row_size);
+                }
+            }
+        } catch (...) {
+            storage->release(extent);
+            throw;
+        }
+        m_offload_storage = storage;
+        m_offloaded = extent;
+        m_offloaded_dims = m_internal_mem->getStaticDims();
+        m_offloaded_scale_zp_dims = std::move(scale_zp_dims);
+    }
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor();
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    return true;
+}
+
+void VariableStateKVcache::read_offloaded(MemoryPtr& internal_mem,
+                                          MemoryPtr& hidden_state,
+                                          PlainTensor& scale_zp) const {
+    // the data have the layout of the dense kv cache memory, so they are read as is
+    internal_mem = std::make_shared<Memory>(get_engine(), m_dense_internal_desc->cloneWithNewDims(m_offloaded_dims));
+    const size_t kv_size = internal_mem->getSize();
+    m_offload_storage->read(m_offloaded, 0, internal_mem->getData(), kv_size);
+
+    const auto& order = m_dense_internal_desc->getOrder();
+    const size_t size_B = m_offloaded_dims[order.at(1)];
+    const size_t size_L = m_offloaded_dims[order.at(0)];
+    auto beam_table_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{size_B, size_L});
+    hidden_state = std::make_shared<Memory>(get_engine(), beam_table_desc);
+    const size_t beam_table_size = hidden_state->getSize();
+    m_offload_storage->read(m_offloaded, kv_size, hidden_state->getData(), beam_table_size);
+
+    scale_zp = PlainTensor();
+    if (!m_offloaded_scale_zp_dims.empty()) {
+        scale_zp.resize<float>(m_offloaded_scale_zp_dims);
+        m_offload_storage->read(m_offloaded,
+                                kv_size + beam_table_size,
+                                scale_zp.ptr<float>(),
+                                m_offloaded.size - kv_size - beam_table_size);
+    }
+}
+
+void VariableStateKVcache::restore() {
+    if (!m_offload_storage) {
+        return;
+    }
+    // the growth reserve is allocated anew by the next token
+    read_offloaded(m_internal_mem, m_hidden_state, m_scale_zp);
+    const auto& internal_desc = m_internal_mem->getDesc();
+    const auto& hidden_state_desc = m_hidden_state->getDesc();
+    m_internal_mem_max_size = internal_desc.getCurrentMemSize() / internal_desc.getPrecision().size();
+    m_hidden_state_max_size = hidden_state_desc.getCurrentMemSize() / hidden_state_desc.getPrecision().size();
+    drop_offloaded();
+}
+
+void VariableStateKVcache::drop_offloaded() {
+    if (m_offload_storage) {
+        m_offload_storage->release(m_offloaded);
+    }
+    m_offload_storage.reset();
+    m_offloaded = {};
+    m_offloaded_dims.clear();
+    m_offloaded_scale_zp_dims.clear();
+}
+
+void VariableStateKVcache::update_pool() {
+    if (m_pool) {
+        m_pool->update(this);
+    }
+}
 }  // namespace ov::intel_cpu
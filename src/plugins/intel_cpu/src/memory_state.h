@@ -6,11 +6,16 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
+#include "kv_cache_offload_storage.h"
+#include "kv_cache_pool.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -124,7 +129,9 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          bool quant_by_channel,
-                         size_t group_size = 0);
+                         size_t group_size = 0,
+                         KVCachePool::Ptr pool = nullptr);
+    ~VariableStateKVcache() override;
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -146,6 +153,7 @@ public:
     }
     void assign_internal_state_max_size(size_t max_size) {
         m_internal_mem_max_size = max_size;
+        update_pool();
     }
 
     size_t hidden_state_max_size() const {
@@ -153,6 +161,7 @@ public:
     }
     void assign_hidden_state_max_size(size_t max_size) {
         m_hidden_state_max_size = max_size;
+        update_pool();
     }
 
     PlainTensor& get_scale_zp() {
@@ -160,14 +169,50 @@ public:
     }
     void set_scale_zp(const PlainTensor& t) {
         m_scale_zp = t;
+        update_pool();
     }
 
+    const KVCachePool::Ptr& get_pool() const {
+        return m_pool;
+    }
+    KVCachePool::Entry& pool_entry() {
+        return m_pool_entry;
+    }
+    // the KV cache memory in bytes, including the growth reserve
+    size_t allocated_size() const;
+    // the size of the data in the offload storage in bytes, if the state is offloaded
+    size_t offloaded_size() const;
+    bool is_offloaded() const;
+    // protects the state from the offloading and brings the offloaded data back, returns true if the state is restored
+    bool pin();
+    void unpin();
+
+    enum class OffloadStatus : uint8_t {
+        Offloaded,
+        Pinned,
+        Failed,  // the data do not fit the available space
+    };
+    // writes the valid data to the offload storage and releases the KV cache memory unless the state is pinned,
+    // the state is kept intact if the data take more than available bytes or the storage fails
+    OffloadStatus try_offload(const KVCacheOffloadStorage::Ptr& storage, uint64_t available);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    void load_state(const ov::SoPtr<ov::ITensor>& state);
+    MemoryPtr dense_copy(const ov::element::Type& precision,
+                         const MemoryPtr& internal_mem,
+                         const MemoryPtr& hidden_state,
+                         const PlainTensor& scale_zp) const;
+    bool offload(const KVCacheOffloadStorage::Ptr& storage, uint64_t available);
+    void read_offloaded(MemoryPtr& internal_mem, MemoryPtr& hidden_state, PlainTensor& scale_zp) const;
+    void restore();
+    void drop_offloaded();
+    void update_pool();
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -180,6 +225,18 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    KVCachePool::Ptr m_pool;
+    KVCachePool::Entry m_pool_entry;
+    // guards the offloading by the pool against the pinning and the access to the state data by the user
+    mutable std::mutex m_offload_mutex;
+    // the offloaded state: the valid tokens of the kv cache [L, B, H, S], of the beam access table [B, L] and of the u8
+    // quantization parameters, stored one after another in the internal precision and layout, so the round trip is
+    // exact
+    KVCacheOffloadStorage::Ptr m_offload_storage;
+    KVCacheOffloadStorage::Extent m_offloaded;
+    VectorDims m_offloaded_dims;
+    VectorDims m_offloaded_scale_zp_dims;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -762,6 +762,7 @@ void Node::updateShapes() {
                     getName());
     try {
         if (needShapeInfer()) {
+            LATENCY(getLatencyProfile(), shapeInfer);
             auto result = shapeInfer();
             if (ShapeInferStatus::success == result.status) {
                 redefineOutputMemory(result.dims);
@@ -813,6 +814,7 @@ void Node::updateDynamicParams() {
                           getName(),
                           " ",
                           getOriginalLayers());
+                LATENCY(getLatencyProfile(), prepareParams);
                 prepareParams();
             }
         }
@@ -1118,7 +1120,7 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         Memory memory{engine, newDesc, internalBlob->getData()};
 
         MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
-        node::Reorder::reorderData(memory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(memory, *_ptr, context->getSharedPrimitivesCache());
         return _ptr;
     };
 
@@ -1127,7 +1129,18 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto string_hash = name + "_" + std::to_string(indx) + "_" +
                                  DnnlExtensionUtils::computeWeightsStringHash(internalBlob, intDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        ptr = weightCache->hasContentStore()
+                  ? static_cast<MemoryPtr>(*weightCache->findOrCreate(
+                        string_hash,
+                        [&]() {
+                            return DnnlExtensionUtils::computeWeightsContentHash(
+                                internalBlob,
+                                MemoryDescUtils::convertToDnnlMemoryDesc(internalBlob->getDescPtr()),
+                                intDesc);
+                        },
+                        internalBlob,
+                        create))
+                  : static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
     } else {
         ptr = create();
     }
@@ -1175,7 +1188,7 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     auto create = [&]() {
         Memory srcMemory{getEngine(), srcWeightDesc, edgeMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(srcMemory, *_ptr, context->getSharedPrimitivesCache());
 
         return _ptr;
     };
@@ -517,6 +517,19 @@ public:
         return perfCounter;
     }
 
+    /**
+     * @brief Returns the latency histograms of the node, nullptr if they are not collected
+     */
+    NodeLatencyProfile* getLatencyProfile() const {
+        return latencyProfile.get();
+    }
+
+    void enableLatencyProfile() {
+        if (!latencyProfile) {
+            latencyProfile = std::make_unique<NodeLatencyProfile>();
+        }
+    }
+
     virtual void resolveInPlaceEdges(Edge::LOOK look);
 
     // @todo this supposed to be 'execute + executeImpl' instead of 'executeStatic + execute'
@@ -919,6 +932,8 @@ private:
 
     PerfCount perfCounter;
     PerfCounters profiling;
+    // allocated only if the latency histograms are collected
+    std::unique_ptr<NodeLatencyProfile> latencyProfile;
 
     MemoryPtr scratchpadMem;
 
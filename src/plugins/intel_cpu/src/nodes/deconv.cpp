@@ -1127,7 +1127,7 @@ void Deconvolution::prepareParams() {
 
     auto prevExecPtr = execPtr;
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedPrimitivesCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
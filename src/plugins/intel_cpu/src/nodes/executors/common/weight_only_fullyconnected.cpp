@@ -0,0 +1,314 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weight_only_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/fullyconnected/weight_only_gemm.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+
+static size_t batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1, static_cast<size_t>(1), std::multiplies<>());
+}
+
+static MemoryCPtr decompressionParams(const MemoryArgs& memory, int argId) {
+    auto it = memory.find(argId);
+    return it == memory.end() ? nullptr : it->second;
+}
+
+// number of the groups along K of the decompression params, which are expected to be [N, groups] or a scalar
+static std::optional<size_t> decompressionGroups(const MemoryCPtr& params, size_t N) {
+    const auto count = params->getShape().getElementsCount();
+    if (count == 1) {
+        return 1;
+    }
+    const auto& dims = params->getStaticDims();
+    if (dims.empty() || dims[0] != N || count % N != 0) {
+        return std::nullopt;
+    }
+    return count / N;
+}
+
+// converts the decompression params to f32 [N, groups], broadcasting the coarser params over the groups
+static std::vector<float> normalizeDecompressionParams(const MemoryCPtr& params, size_t N, size_t groups) {
+    const auto count = params->getShape().getElementsCount();
+    std::vector<float> converted(count);
+    cpu_convert(params->getData(), converted.data(), params->getPrecision(), f32, count);
+    if (count == N * groups) {
+        return converted;
+    }
+
+    const size_t paramsGroups = count == 1 ? 1 : count / N;
+    const size_t ratio = groups / paramsGroups;
+    std::vector<float> result(N * groups);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t g = 0; g < groups; g++) {
+            result[n * groups + g] = count == 1 ? converted[0] : converted[n * paramsGroups + g / ratio];
+        }
+    }
+    return result;
+}
+
+static size_t commonDecompressionGroups(const MemoryArgs& memory, size_t N) {
+    size_t groups = *decompressionGroups(memory.at(ARG_WEI | ARG_ATTR_SCALES), N);
+    if (const auto zeroPoints = decompressionParams(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS)) {
+        groups = std::max(groups, *decompressionGroups(zeroPoints, N));
+    }
+    return groups;
+}
+
+void WeightOnlyFCExecutor::packWeights(const WeightOnlyGemmLayout& layout,
+                                       const void* weights,
+                                       ov::element::Type weightsType,
+                                       const float* scales,
+                                       const float* zeroPoints,
+                                       uint8_t* dst) {
+    constexpr size_t blockN = WeightOnlyGemmLayout::blockN;
+    const auto* src = static_cast<const uint8_t*>(weights);
+    // signed weights are stored biased to unsigned (w + 2^(bits-1) is w with the sign bit flipped),
+    // the same bias is added to their zero points
+    const uint8_t signFlip = any_of(weightsType, i8, i4) ? static_cast<uint8_t>(1U << (layout.bits - 1)) : 0;
+    const float zeroPointBias = static_cast<float>(signFlip);
+    const size_t K = layout.K;
+
+    auto getWeight = [&](size_t n, size_t k) -> uint8_t {
+        const size_t idx = n * K + k;
+        if (layout.bits == 8) {
+            return static_cast<uint8_t>(src[idx] ^ signFlip);
+        }
+        const uint8_t byte = src[idx / 2];
+        return static_cast<uint8_t>(((idx % 2 != 0U) ? (byte >> 4) : (byte & 0x0F)) ^ signFlip);
+    };
+
+    parallel_for(layout.blocks(), [&](size_t b) {
+        uint8_t* block = dst + b * layout.blockSize();
+        const size_t n0 = b * blockN;
+        const size_t valid = std::min(blockN, layout.N - n0);
+        std::fill_n(block, layout.blockSize(), 0);
+        for (size_t k = 0; k < K; k++) {
+            uint8_t* row = block + k * layout.rowSize();
+            for (size_t j = 0; j < valid; j++) {
+                const uint8_t w = getWeight(n0 + j, k);
+                if (layout.bits == 8) {
+                    row[j] = w;
+                } else if (j < blockN / 2) {
+                    row[j] |= w;
+                } else {
+                    row[j - blockN / 2] |= static_cast<uint8_t>(w << 4);
+                }
+            }
+        }
+        // the channels of the tail block beyond N have zero scales, so they produce zeros
+        auto storeParams = [&](auto* blockScales) {
+            auto* blockZeroPoints = blockScales + layout.groups * blockN;
+            using ParamType = std::remove_pointer_t<decltype(blockScales)>;
+            for (size_t g = 0; g < layout.groups; g++) {
+                for (size_t j = 0; j < valid; j++) {
+                    const size_t idx = (n0 + j) * layout.groups + g;
+                    blockScales[g * blockN + j] = static_cast<ParamType>(scales[idx]);
+                    blockZeroPoints[g * blockN + j] =
+                        static_cast<ParamType>((zeroPoints ? zeroPoints[idx] : 0.0F) + zeroPointBias);
+                }
+            }
+        };
+        if (layout.paramsSize == sizeof(ov::float16)) {
+            storeParams(reinterpret_cast<ov::float16*>(block + layout.weightsSize()));
+        } else {
+            storeParams(reinterpret_cast<float*>(block + layout.weightsSize()));
+        }
+    });
+}
+
+static MemoryCPtr prepareWeightMemory(const WeightOnlyGemmLayout& layout,
+                                      const MemoryArgs& memory,
+                                      const ExecutorContext::CPtr& context) {
+    const auto& weightsMemory = memory.at(ARG_WEI);
+    const auto& scalesMemory = memory.at(ARG_WEI | ARG_ATTR_SCALES);
+    const auto zeroPointsMemory = decompressionParams(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+
+    auto create = [&]() {
+        DEBUG_LOG("WeightOnlyFCExecutor: pack weights, ", layout.size(), " bytes");
+        const auto scales = normalizeDecompressionParams(scalesMemory, layout.N, layout.groups);
+        std::vector<float> zeroPoints;
+        if (zeroPointsMemory) {
+            zeroPoints = normalizeDecompressionParams(zeroPointsMemory, layout.N, layout.groups);
+        }
+
+        MemoryPtr packed =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(u8, Shape{layout.size()}));
+        WeightOnlyFCExecutor::packWeights(layout,
+                                          weightsMemory->getData(),
+                                          weightsMemory->getPrecision(),
+                                          scales.data(),
+                                          zeroPoints.empty() ? nullptr : zeroPoints.data(),
+                                          packed->getDataAs<uint8_t>());
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        // the packing depends on the addresses of the decompression params as well, which change on the import, so it
+        // is not exported with the prepacked weights (see CompiledModel::get_packed_weights): the key does not end
+        // with a constant address
+        const std::string string_hash =
+            "weight_only_fc_" + std::to_string(layout.N) + "_" + std::to_string(layout.K) + "_" +
+            std::to_string(layout.groups) + "_" + std::to_string(layout.paramsSize) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData())) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(scalesMemory->getData())) + "_" +
+            std::to_string(zeroPointsMemory ? reinterpret_cast<uint64_t>(zeroPointsMemory->getData()) : 0) +
+            "_not_exported";
+        return MemoryCPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    return create();
+}
+
+// the f16 params halve the footprint of the params, they are taken only if the conversion is exact
+static bool packParamsAsF16(const MemoryArgs& memory) {
+    if (memory.at(ARG_WEI | ARG_ATTR_SCALES)->getPrecision() != f16) {
+        return false;
+    }
+    const auto zeroPoints = decompressionParams(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+    if (!zeroPoints) {
+        return true;
+    }
+    // the integer zero points biased for the signed weights stay below 2^8, the f16 ones are not biased
+    const auto weightsType = memory.at(ARG_WEI)->getPrecision();
+    return any_of(zeroPoints->getPrecision(), u8, u4, i8, i4) ||
+           (zeroPoints->getPrecision() == f16 && any_of(weightsType, u8, u4));
+}
+
+static WeightOnlyGemmLayout makeLayout(const MemoryArgs& memory) {
+    const auto& weightsMemory = memory.at(ARG_WEI);
+    const auto& weiDims = weightsMemory->getStaticDims();
+    const size_t N = weiDims[0];
+    const size_t K = weiDims[1];
+    const size_t bits = weightsMemory->getPrecision().bitwidth();
+    return {N,
+            K,
+            commonDecompressionGroups(memory, N),
+            bits,
+            packParamsAsF16(memory) ? sizeof(ov::float16) : sizeof(float)};
+}
+
+bool WeightOnlyFCExecutor::supports(const FCConfig& config) {
+    VERIFY(config.attrs.weightOnlyFC, UNSUPPORTED_BY_EXECUTOR);
+    // the executor must serve all the shapes of the node: otherwise the dnnl executor is created for the larger M and
+    // both packings of the weights stay in memory
+    const auto& srcMaxDims = config.descs.at(ARG_SRC)->getShape().getMaxDims();
+    VERIFY(std::all_of(srcMaxDims.begin(),
+                       srcMaxDims.end() - 1,
+                       [](const Dim dim) {
+                           return dim <= WeightOnlyGemmLayout::maxM;
+                       }) &&
+               batchDim(srcMaxDims) <= WeightOnlyGemmLayout::maxM,
+           UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    // the weights are packed once, at creation
+    VERIFY(!config.attrs.nonConstantWeights, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(!config.attrs.weightsNonTransposed, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(all_of(f32, srcType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(any_of(weiType(config), u8, i8, u4, i4), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+    if (config.attrs.withBias) {
+        VERIFY(biaType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+        const auto& biasDims = config.descs.at(ARG_BIAS)->getShape().getDims();
+        VERIFY(std::all_of(biasDims.begin(),
+                           biasDims.end() - 1,
+                           [](const Dim dim) {
+                               return dim == 1;
+                           }),
+               UNSUPPORTED_BY_EXECUTOR);
+    }
+
+    return true;
+}
+
+bool WeightOnlyFCExecutor::acceptsShapes(const MemoryArgs& memory) {
+    const auto& srcShape = memory.at(ARG_SRC)->getShape();
+    VERIFY(srcShape.isStatic(), HEURISTICS_MISMATCH);
+    VERIFY(batchDim(srcShape.getStaticDims()) <= WeightOnlyGemmLayout::maxM, HEURISTICS_MISMATCH);
+
+    const auto scales = decompressionParams(memory, ARG_WEI | ARG_ATTR_SCALES);
+    VERIFY(scales, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    const auto& weiDims = memory.at(ARG_WEI)->getStaticDims();
+    const size_t N = weiDims[0];
+    const size_t K = weiDims[1];
+    const auto scalesGroups = decompressionGroups(scales, N);
+    VERIFY(scalesGroups && K % *scalesGroups == 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+
+    if (const auto zeroPoints = decompressionParams(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS)) {
+        VERIFY(zeroPoints->getPrecision() != dynamic, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+        const auto zeroPointsGroups = decompressionGroups(zeroPoints, N);
+        VERIFY(zeroPointsGroups && K % *zeroPointsGroups == 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+        const auto groups = std::max(*scalesGroups, *zeroPointsGroups);
+        VERIFY(groups % *scalesGroups == 0 && groups % *zeroPointsGroups == 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    }
+
+    return true;
+}
+
+WeightOnlyFCExecutor::WeightOnlyFCExecutor(const FCAttrs& attrs,
+                                           const MemoryArgs& memory,
+                                           const ExecutorContext::CPtr& context)
+    : m_withBias(attrs.withBias),
+      m_layout(makeLayout(memory)),
+      m_packedWeights(prepareWeightMemory(m_layout, memory, context)) {}
+
+bool WeightOnlyFCExecutor::update(const MemoryArgs& memory) {
+    M = batchDim(memory.at(ARG_DST)->getStaticDims());
+    return M <= WeightOnlyGemmLayout::maxM;
+}
+
+void WeightOnlyFCExecutor::execute(const MemoryArgs& memory) {
+    if (M == 0) {
+        return;
+    }
+    ov::Extensions::Cpu::XARCH::weight_only_gemm(m_packedWeights->getDataAs<const uint8_t>(),
+                                                 m_layout,
+                                                 memory.at(ARG_SRC)->getDataAs<const float>(),
+                                                 M,
+                                                 m_withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr,
+                                                 memory.at(ARG_DST)->getDataAs<float>());
+}
+
+void WeightOnlyFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (m_curNumaNode == numaNodeID) {
+        return;
+    }
+    m_curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/fullyconnected/weight_only_gemm.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected with u8/i8/u4/i4 weights and group-wise decompression scales / zero points
+ * for the small batch (LLM decode). Such a gemm is bound by the weights bandwidth, so the weights are streamed
+ * once in the compressed form and dequantized in registers instead of being decompressed or reordered per call.
+ *
+ * The executor is opt-in (ov::intel_cpu::weight_only_fc) and is selected only if the number of rows of the node is
+ * bounded by WeightOnlyGemmLayout::maxM, so it replaces the dnnl executor instead of coexisting with it: the dnnl
+ * packing is opaque and can't be shared, so a node served by both would keep the weights twice.
+ * The packing takes WeightOnlyGemmLayout::size(), i.e. the compressed weights plus 4 bytes (f16) or 8 bytes (f32) of
+ * the params per group and output channel, see the PackedFootprint unit test.
+ */
+class WeightOnlyFCExecutor : public Executor {
+public:
+    WeightOnlyFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    bool update(const MemoryArgs& memory) override;
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::gemm_any;
+    }
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    static bool supports(const FCConfig& config);
+
+    // the executor is selected only while the number of rows is small enough
+    static bool acceptsShapes(const MemoryArgs& memory);
+
+    /**
+     * @brief Packs [N, K] weights into the WeightOnlyGemmLayout.
+     * @param scales f32 decompression scales [N, groups]
+     * @param zeroPoints f32 decompression zero points [N, groups], may be nullptr
+     */
+    static void packWeights(const WeightOnlyGemmLayout& layout,
+                            const void* weights,
+                            ov::element::Type weightsType,
+                            const float* scales,
+                            const float* zeroPoints,
+                            uint8_t* dst);
+
+private:
+    const bool m_withBias;
+    WeightOnlyGemmLayout m_layout;
+    MemoryCPtr m_packedWeights;
+    size_t M = 0;
+    int m_curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
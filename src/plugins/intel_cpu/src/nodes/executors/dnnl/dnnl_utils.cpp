@@ -102,9 +102,18 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        ptr = MemoryPtr(
-            *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+        const auto key = DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc);
+        ptr = globalWeightCache->hasContentStore()
+                  ? MemoryPtr(*globalWeightCache->findOrCreate(
+                        key,
+                        [&]() {
+                            return DnnlExtensionUtils::computeWeightsContentHash(weightsMem,
+                                                                                 srcWeightDesc,
+                                                                                 dstWeightDesc);
+                        },
+                        weightsMem,
+                        create))
+                  : MemoryPtr(*globalWeightCache->findOrCreate(key, create));
     } else {
         ptr = create();
     }
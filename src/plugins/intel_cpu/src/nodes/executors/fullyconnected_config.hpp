@@ -21,6 +21,8 @@ struct FCAttrs {
     bool sparseWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool nonConstantWeights = false;
+    // the weight-only executor is allowed (see ov::intel_cpu::weight_only_fc)
+    bool weightOnlyFC = false;
 
     ov::intel_cpu::Config::ModelType modelType = ov::intel_cpu::Config::ModelType::Unknown;
 
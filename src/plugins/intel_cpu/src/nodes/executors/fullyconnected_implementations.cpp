@@ -10,6 +10,7 @@
 #include "debug_messages.hpp"
 #include "implementation_utils.hpp"
 #include "memory_desc/cpu_memory_desc.h"
+#include "nodes/executors/common/weight_only_fullyconnected.hpp"
 #include "nodes/executors/convolution_config.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected_primitive.hpp"
@@ -198,6 +199,28 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
             AcceptsAnyShape<FCAttrs>,
             CreateDefault<MlasGemmExecutor, FCAttrs>{}
             )
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_weight_only",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                // the kernel is not faster than the dnnl decompression below avx2
+                VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2), UNSUPPORTED_ISA);
+                VERIFY(WeightOnlyFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            // acceptsShapes
+            []([[maybe_unused]] const FCAttrs& attrs,
+               const MemoryArgs& memory) -> bool {
+                // small M (LLM decode) is bound by the weights bandwidth,
+                // larger M is left to the compute optimized implementations
+                return WeightOnlyFCExecutor::acceptsShapes(memory);
+            },
+            CreateDefault<WeightOnlyFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_X64(
             "convolution_1x1_dnnl",
             ExecutorType::Dnnl,
@@ -568,6 +568,7 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
                                                         context->getConfig().fcSparseWeiDecompressionRate);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
+    attrs.weightOnlyFC = context->getConfig().weightOnlyFC;
 
     attrs.postOps = getPostOps(fusedWith);
 
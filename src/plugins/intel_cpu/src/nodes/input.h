@@ -72,6 +72,11 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    // the memory of the constant is held by the weights cache, otherwise it is the data of the model used in place or
+    // the clone owned by the graph
+    bool isConstMemoryCached() const {
+        return m_constMemoryCached;
+    }
 
     void execute(const dnnl::stream& strm) override {}
     void executeDynamicImpl(const dnnl::stream& strm) override {}
@@ -101,6 +106,7 @@ private:
     MemoryDescPtr extMemDesc = nullptr;
     bool m_useParentMemoryDescForOutput = false;
     bool m_isInPlace = false;
+    bool m_constMemoryCached = false;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -0,0 +1,262 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "weight_only_gemm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/float16.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+using ov::intel_cpu::WeightOnlyGemmLayout;
+
+namespace {
+
+constexpr size_t blockN = WeightOnlyGemmLayout::blockN;
+constexpr size_t maxM = WeightOnlyGemmLayout::maxM;
+
+#if defined(HAVE_AVX512F)
+inline __m512 load_params(const uint8_t* params, bool half) {
+    return half ? _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(params)))
+                : _mm512_loadu_ps(reinterpret_cast<const float*>(params));
+}
+#elif defined(HAVE_AVX2)
+inline __m256 load_params(const uint8_t* params, bool half) {
+    return half ? _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(params)))
+                : _mm256_loadu_ps(reinterpret_cast<const float*>(params));
+}
+#else
+inline void load_params(const uint8_t* params, bool half, float* dst) {
+    for (size_t j = 0; j < blockN; j++) {
+        dst[j] = half ? static_cast<float>(reinterpret_cast<const ov::float16*>(params)[j])
+                      : reinterpret_cast<const float*>(params)[j];
+    }
+}
+#endif
+
+/**
+ * Computes the [M, blockN] tile of one block. The weights of a group are accumulated without the zero points and
+ * the scales, those are applied once per group: sum(x * (w - zp)) * s = (sum(x * w) - zp * sum(x)) * s.
+ */
+template <size_t M, size_t Bits>
+void gemm_block(const WeightOnlyGemmLayout& layout,
+                const uint8_t* block,
+                const float* src,
+                const float* srcSums,
+                float* out) {
+    const size_t K = layout.K;
+    const size_t groupSize = layout.groupSize();
+    constexpr size_t rowSize = blockN * Bits / 8;
+    const bool half = layout.paramsSize == sizeof(ov::float16);
+    const size_t paramsRowSize = blockN * layout.paramsSize;
+    const uint8_t* scales = block + layout.weightsSize();
+    const uint8_t* zeroPoints = scales + layout.groups * paramsRowSize;
+#if defined(HAVE_AVX512F)
+    static_assert(blockN == 16, "The block must fit a single avx512 register");
+    __m512 acc[M];
+    __m512 groupAcc[M];
+    for (size_t m = 0; m < M; m++) {
+        acc[m] = _mm512_setzero_ps();
+    }
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    for (size_t g = 0; g < layout.groups; g++) {
+        for (size_t m = 0; m < M; m++) {
+            groupAcc[m] = _mm512_setzero_ps();
+        }
+        const size_t kStart = g * groupSize;
+        const uint8_t* row = block + kStart * rowSize;
+        for (size_t k = kStart; k < kStart + groupSize; k++, row += rowSize) {
+            __m128i bytes;
+            if constexpr (Bits == 4) {
+                const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row));
+                bytes = _mm_unpacklo_epi64(_mm_and_si128(packed, nibbleMask),
+                                           _mm_and_si128(_mm_srli_epi16(packed, 4), nibbleMask));
+            } else {
+                bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+            }
+            const __m512 weights = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+            for (size_t m = 0; m < M; m++) {
+                groupAcc[m] = _mm512_fmadd_ps(_mm512_set1_ps(src[m * K + k]), weights, groupAcc[m]);
+            }
+        }
+        const __m512 scale = load_params(scales + g * paramsRowSize, half);
+        const __m512 zeroPoint = load_params(zeroPoints + g * paramsRowSize, half);
+        for (size_t m = 0; m < M; m++) {
+            const __m512 sum = _mm512_set1_ps(srcSums[m * layout.groups + g]);
+            acc[m] = _mm512_fmadd_ps(_mm512_fnmadd_ps(zeroPoint, sum, groupAcc[m]), scale, acc[m]);
+        }
+    }
+    for (size_t m = 0; m < M; m++) {
+        _mm512_storeu_ps(out + m * blockN, acc[m]);
+    }
+#elif defined(HAVE_AVX2)
+    static_assert(blockN == 16, "The block must fit two avx2 registers");
+    __m256 acc[2 * M];
+    __m256 groupAcc[2 * M];
+    for (size_t i = 0; i < 2 * M; i++) {
+        acc[i] = _mm256_setzero_ps();
+    }
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    for (size_t g = 0; g < layout.groups; g++) {
+        for (size_t i = 0; i < 2 * M; i++) {
+            groupAcc[i] = _mm256_setzero_ps();
+        }
+        const size_t kStart = g * groupSize;
+        const uint8_t* row = block + kStart * rowSize;
+        for (size_t k = kStart; k < kStart + groupSize; k++, row += rowSize) {
+            __m128i low;
+            __m128i high;
+            if constexpr (Bits == 4) {
+                const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row));
+                low = _mm_and_si128(packed, nibbleMask);
+                high = _mm_and_si128(_mm_srli_epi16(packed, 4), nibbleMask);
+            } else {
+                low = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row));
+                high = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + 8));
+            }
+            const __m256 weightsLow = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(low));
+            const __m256 weightsHigh = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(high));
+            for (size_t m = 0; m < M; m++) {
+                const __m256 x = _mm256_set1_ps(src[m * K + k]);
+                groupAcc[2 * m] = _mm256_fmadd_ps(x, weightsLow, groupAcc[2 * m]);
+                groupAcc[2 * m + 1] = _mm256_fmadd_ps(x, weightsHigh, groupAcc[2 * m + 1]);
+            }
+        }
+        for (size_t part = 0; part < 2; part++) {
+            const size_t offset = g * paramsRowSize + part * 8 * layout.paramsSize;
+            const __m256 scale = load_params(scales + offset, half);
+            const __m256 zeroPoint = load_params(zeroPoints + offset, half);
+            for (size_t m = 0; m < M; m++) {
+                const __m256 sum = _mm256_set1_ps(srcSums[m * layout.groups + g]);
+                auto& accumulator = acc[2 * m + part];
+                accumulator =
+                    _mm256_fmadd_ps(_mm256_fnmadd_ps(zeroPoint, sum, groupAcc[2 * m + part]), scale, accumulator);
+            }
+        }
+    }
+    for (size_t m = 0; m < M; m++) {
+        _mm256_storeu_ps(out + m * blockN, acc[2 * m]);
+        _mm256_storeu_ps(out + m * blockN + 8, acc[2 * m + 1]);
+    }
+#else
+    float acc[M][blockN] = {};
+    for (size_t g = 0; g < layout.groups; g++) {
+        float groupAcc[M][blockN] = {};
+        const size_t kStart = g * groupSize;
+        const uint8_t* row = block + kStart * rowSize;
+        for (size_t k = kStart; k < kStart + groupSize; k++, row += rowSize) {
+            float weights[blockN];
+            if constexpr (Bits == 4) {
+                for (size_t j = 0; j < blockN / 2; j++) {
+                    weights[j] = static_cast<float>(row[j] & 0x0F);
+                    weights[j + blockN / 2] = static_cast<float>(row[j] >> 4);
+                }
+            } else {
+                for (size_t j = 0; j < blockN; j++) {
+                    weights[j] = static_cast<float>(row[j]);
+                }
+            }
+            for (size_t m = 0; m < M; m++) {
+                const float x = src[m * K + k];
+                for (size_t j = 0; j < blockN; j++) {
+                    groupAcc[m][j] += x * weights[j];
+                }
+            }
+        }
+        float scale[blockN];
+        float zeroPoint[blockN];
+        load_params(scales + g * paramsRowSize, half, scale);
+        load_params(zeroPoints + g * paramsRowSize, half, zeroPoint);
+        for (size_t m = 0; m < M; m++) {
+            const float sum = srcSums[m * layout.groups + g];
+            for (size_t j = 0; j < blockN; j++) {
+                acc[m][j] += (groupAcc[m][j] - zeroPoint[j] * sum) * scale[j];
+            }
+        }
+    }
+    for (size_t m = 0; m < M; m++) {
+        std::copy_n(acc[m], blockN, out + m * blockN);
+    }
+#endif
+}
+
+using GemmBlockKernel = void (*)(const WeightOnlyGemmLayout&, const uint8_t*, const float*, const float*, float*);
+
+template <size_t Bits, size_t... Ms>
+constexpr std::array<GemmBlockKernel, sizeof...(Ms)> make_kernels(std::index_sequence<Ms...> /*unused*/) {
+    return {&gemm_block<Ms + 1, Bits>...};
+}
+
+GemmBlockKernel select_kernel(size_t bits, size_t M) {
+    static constexpr auto kernels4 = make_kernels<4>(std::make_index_sequence<maxM>{});
+    static constexpr auto kernels8 = make_kernels<8>(std::make_index_sequence<maxM>{});
+    return bits == 4 ? kernels4[M - 1] : kernels8[M - 1];
+}
+
+}  // namespace
+
+void weight_only_gemm(const uint8_t* packed,
+                      const WeightOnlyGemmLayout& layout,
+                      const float* src,
+                      size_t M,
+                      const float* bias,
+                      float* dst) {
+    OPENVINO_ASSERT(M >= 1 && M <= maxM, "weight_only_gemm supports up to ", maxM, " rows, got ", M);
+    OPENVINO_ASSERT(layout.bits == 4 || layout.bits == 8,
+                    "weight_only_gemm supports 4 and 8 bit weights, got ",
+                    layout.bits);
+    OPENVINO_ASSERT(layout.paramsSize == sizeof(float) || layout.paramsSize == sizeof(ov::float16),
+                    "weight_only_gemm supports f32 and f16 decompression params");
+    const size_t N = layout.N;
+    const size_t K = layout.K;
+    const size_t groups = layout.groups;
+    const size_t groupSize = layout.groupSize();
+
+    std::vector<float> srcSums(M * groups, 0.0F);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t g = 0; g < groups; g++) {
+            const float* x = src + m * K + g * groupSize;
+            float sum = 0.0F;
+            for (size_t k = 0; k < groupSize; k++) {
+                sum += x[k];
+            }
+            srcSums[m * groups + g] = sum;
+        }
+    }
+
+    const auto kernel = select_kernel(layout.bits, M);
+    const size_t blocks = layout.blocks();
+    const size_t blockSize = layout.blockSize();
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        float out[maxM * blockN];
+        for (size_t b = start; b < end; b++) {
+            kernel(layout, packed + b * blockSize, src, srcSums.data(), out);
+            const size_t n0 = b * blockN;
+            const size_t valid = std::min(blockN, N - n0);
+            for (size_t m = 0; m < M; m++) {
+                float* y = dst + m * N + n0;
+                const float* tile = out + m * blockN;
+                for (size_t j = 0; j < valid; j++) {
+                    y[j] = bias ? tile[j] + bias[n0 + j] : tile[j];
+                }
+            }
+        }
+    });
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Layout of the u8/u4 weights packed for the small-M weight-only gemm.
+ *
+ * The output channels are split into blocks of blockN channels. A block keeps the weights of all K rows
+ * contiguously (the blockN channels of one row are adjacent), followed by the scales and zero points of its groups
+ * ([groups, blockN] each), stored as f16 if the original ones are exactly representable in it and as f32 otherwise.
+ * For 4-bit weights the byte j of a row holds the channel j in the low nibble and the channel j + blockN / 2 in the
+ * high nibble.
+ */
+struct WeightOnlyGemmLayout {
+    static constexpr size_t blockN = 16;
+    static constexpr size_t maxM = 8;
+
+    WeightOnlyGemmLayout(size_t N, size_t K, size_t groups, size_t bits, size_t paramsSize = sizeof(float))
+        : N(N),
+          K(K),
+          groups(groups),
+          bits(bits),
+          paramsSize(paramsSize) {}
+
+    [[nodiscard]] size_t groupSize() const {
+        return K / groups;
+    }
+
+    [[nodiscard]] size_t blocks() const {
+        return div_up(N, blockN);
+    }
+
+    [[nodiscard]] size_t rowSize() const {
+        return blockN * bits / 8;
+    }
+
+    [[nodiscard]] size_t weightsSize() const {
+        return K * rowSize();
+    }
+
+    [[nodiscard]] size_t blockSize() const {
+        // each block starts at a cache line
+        return rnd_up(weightsSize() + 2 * groups * blockN * paramsSize, 64);
+    }
+
+    [[nodiscard]] size_t size() const {
+        return blocks() * blockSize();
+    }
+
+    size_t N;
+    size_t K;
+    size_t groups;
+    size_t bits;
+    // bytes of a scale or a zero point: 2 (f16) or 4 (f32)
+    size_t paramsSize;
+};
+
+}  // namespace ov::intel_cpu
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * @brief Computes dst[M, N] = src[M, K] * W^T (+ bias) for M <= WeightOnlyGemmLayout::maxM, where W is
+ * dequantized from the packed weights on the fly. The output channel blocks are split between the threads,
+ * so every weight is loaded once for all M rows.
+ */
+void weight_only_gemm(const uint8_t* packed,
+                      const ov::intel_cpu::WeightOnlyGemmLayout& layout,
+                      const float* src,
+                      size_t M,
+                      const float* bias,
+                      float* dst);
+
+}  // namespace ov::Extensions::Cpu::XARCH
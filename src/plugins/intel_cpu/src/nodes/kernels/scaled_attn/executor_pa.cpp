@@ -1204,13 +1204,15 @@ struct MHAHelper {
 #    endif
 
         for (size_t pq = 0; pq < q_len; pq++) {
+            // the query tokens are the last q_len tokens of the sequence
+            auto ncausal = cur_kv_len - q_len + pq + 1;
             for (size_t h = hq_beg; h < hq_end; h++) {
                 // apply attention mask & sofmax
                 float* alibi_lookup = nullptr;
                 float alibi_slope = 0.F;
                 if (alibi_slopes) {
                     alibi_slope = alibi_slopes.ptr<float>()[h];
-                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - cur_kv_len;
+                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - ncausal;
                 }
                 attn_softmax_kernel<float>(_weight.ptr<float>(ithr, h - hq_beg, pq),
                                            _weight.ptr<float>(ithr, h - hq_beg, pq),
@@ -1219,7 +1221,7 @@ struct MHAHelper {
                                            nullptr,
                                            nullptr,
                                            false,
-                                           cur_kv_len,
+                                           ncausal,
                                            cur_kv_len,
                                            ov::element::f32,
                                            ov::element::f32,
@@ -1272,7 +1274,8 @@ struct MHAHelper {
 
     // compute one token, loop along batch, head dimensions and kv_len, it's special for very long kv_len with small
     // batch tokens. It will assume NO mixture execution of first and second token. all tensors such as query... have
-    // batch dimension which is DIFFERENT from above
+    // batch dimension which is DIFFERENT from above. L > 1 is the case of the draft tokens verification: every
+    // sequence has L new tokens on top of its cache, which are masked causally
     //  query: [B, H, L, S]
     //  key_cache: [block_number, H, _block_size, S]
     //  value_cache: [block_number, H, _block_size, Sv]
@@ -1326,7 +1329,7 @@ struct MHAHelper {
                 }
             };
         auto loop_qk = [&](size_t b, size_t pk_in_blocks, size_t hx) {
-            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + q_len;
             size_t hk = 0;
             size_t hq_beg = 0;
             size_t hq_end = 0;
@@ -1380,14 +1383,15 @@ struct MHAHelper {
         };
 
         auto loop_softmax = [&](size_t b, size_t h, size_t pq) {
-            auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
-            auto ncausal = cur_kv_len;
+            auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + q_len;
+            // the query tokens are the last q_len tokens of the sequence
+            auto ncausal = cur_kv_len - q_len + pq + 1;
             // apply attention mask & sofmax
             float* alibi_lookup = nullptr;
             float alibi_slope = 0.F;
             if (alibi_slopes) {
                 alibi_slope = alibi_slopes.ptr<float>()[h];
-                alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - cur_kv_len;
+                alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - ncausal;
             }
             attn_softmax_kernel<float>(_weight_bhl.ptr<float>(b, h, pq),
                                        _weight_bhl.ptr<float>(b, h, pq),
@@ -1414,7 +1418,7 @@ struct MHAHelper {
 
         if (output_score) {
             parallel_for2d_dynamic(B, q_len, [&](size_t b, size_t pq) {
-                auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+                auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + q_len;
                 const auto score_win_len = score_aggregation_window ? score_aggregation_window.ptr<int32_t>()[b] : 1;
                 auto* dst = output_score.ptr<float>() + _score_infos[b].score_offsets;
                 if (score_win_len) {
@@ -1434,7 +1438,7 @@ struct MHAHelper {
         });
 
         auto loop_wk = [&](size_t b, size_t pv_in_blocks, size_t hx) {
-            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + q_len;
             auto pv = pv_in_blocks * _block_size;
             size_t hk = 0;
             size_t hq_beg = 0;
@@ -1491,9 +1495,33 @@ struct MHA {
     MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& _helper;
 
     WorkItems _workitems;
+    PrefixSharing _prefix_sharing;
+
+    // the sequences with up to this number of new tokens are computed by the second token kernels
+    static constexpr size_t max_multi_token_q_len = 8;
+    size_t _max_decode_q_len = 1;
 
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
 
+    // copy the attention result of the shared prefix blocks from the leaders, the sequences are processed in order
+    // since a leader may take its own prefix from a previous sequence
+    void copy_shared_prefix(const PlainTensor& output_emb, const PlainTensor& subsequence_begins) {
+        const auto* begins = subsequence_begins.ptr<int32_t>();
+        const auto row_size = output_emb.m_dims[2] * sizeof(DATA_TYPE);
+        for (size_t i = 0; i + 1 < subsequence_begins.m_dims[0]; i++) {
+            const auto leader = _prefix_sharing.get_leader(i);
+            if (leader < 0) {
+                continue;
+            }
+            const auto shared_len = static_cast<size_t>(_prefix_sharing.get_shared_blocks(i)) * _helper._block_size;
+            parallel_for(shared_len, [&](size_t m) {
+                std::memcpy(output_emb.ptr<DATA_TYPE>(begins[i] + m),
+                            output_emb.ptr<DATA_TYPE>(begins[leader] + m),
+                            row_size);
+            });
+        }
+    }
+
     // one loop to handle first and second tokens
     void exec_loop_mixed(const PlainTensor& q,
                          PlainTensor& k_cache,
@@ -1642,8 +1670,8 @@ struct MHA {
             const auto q_len = static_cast<size_t>(item.q_len);
             size_t ithr = static_cast<size_t>(parallel_get_thread_num());
 
-            if (q_len == 1) {
-                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + 1;
+            if (q_len <= _max_decode_q_len) {
+                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + q_len;
                 float* score_output = nullptr;
                 if (output_score) {
                     const auto score_win_len =
@@ -1654,17 +1682,22 @@ struct MHA {
                     }
                 }
 
+                PlainTensor sub_query;
+                sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
+                // physical layout (B_in_tokens, H, S)
+                sub_query = sub_query.permute({1, 0, 2});
                 _helper.exec_kernel_one_bh(
-                    q.slice(0, batch_in_token, batch_in_token),
+                    sub_query,
                     k_cache,
                     v_cache,
-                    output_emb.slice(0, batch_in_token, batch_in_token),
+                    output_emb.slice(0, batch_in_token, batch_in_token + q_len)
+                        .reshape({q_len, _helper.H * _helper.SV}),
                     block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
                     ithr,
                     hq_beg,
                     hq_end,
                     hk,
-                    1UL,
+                    q_len,
                     cur_kv_len,
                     alibi_slopes,
                     score_output);
@@ -1798,15 +1831,32 @@ struct MHA {
                     const PlainTensor& block_indices_begins,
                     const PlainTensor& alibi_slopes,
                     const PlainTensor& score_aggregation_window) {
-        _workitems
-            .reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, _helper._block_size);
+        // the second token kernels apply neither the sliding window nor the per query scores aggregation
+        _workitems.reset(query,
+                         past_lens,
+                         subsequence_begins,
+                         block_indices,
+                         block_indices_begins,
+                         _helper._block_size,
+                         _prefix_sharing.empty() ? nullptr : &_prefix_sharing,
+                         (output_score || _helper._sliding_window) ? 1 : max_multi_token_q_len);
+        // limited by the block size
+        _max_decode_q_len = _workitems.get_max_decode_q_len();
         if (output_score) {
             _helper.init_score_buffers(past_lens, subsequence_begins, score_aggregation_window);
         }
 
         auto nthr = static_cast<size_t>(parallel_get_max_threads());
+        // exec_loop_bhl expects the same number of new tokens in every sequence
+        const auto B_seq = past_lens.m_dims[0];
+        const auto q_len = B_seq ? query.m_dims[0] / B_seq : 1;
+        bool same_q_len = B_seq && query.m_dims[0] % B_seq == 0;
+        for (size_t b = 0; b < B_seq && same_q_len; b++) {
+            same_q_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1] -
+                                             subsequence_begins.ptr<int32_t>()[b]) == q_len;
+        }
 
-        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0) {
+        if (B_seq >= nthr || _workitems.get_reorder_max_batch_size() > 0 || !same_q_len) {
             exec_loop_mixed(query,
                             present_key,
                             present_value,
@@ -1819,11 +1869,17 @@ struct MHA {
                             block_indices_begins,
                             alibi_slopes,
                             score_aggregation_window);
+            if (!_prefix_sharing.empty()) {
+                copy_shared_prefix(output_emb, subsequence_begins);
+            }
         } else {
-            _helper.exec_loop_bhl(query,
+            // [B_token, H, 1, S] -> [B_seq, H, q_len, S]
+            auto seq_query = q_len == 1 ? query
+                                        : query.reshape({B_seq, q_len, _helper.H, _helper.S}).permute({0, 2, 1, 3});
+            _helper.exec_loop_bhl(seq_query,
                                   present_key,
                                   present_value,
-                                  output_emb,
+                                  q_len == 1 ? output_emb : output_emb.reshape({B_seq, q_len, _helper.H * _helper.SV}),
                                   output_score,
                                   max_context_len,
                                   past_lens,
@@ -2084,15 +2140,26 @@ struct AttentionExecutor : public PagedAttentionExecutor {
         auto B_token = k.size(0);
         _slot_mapping.resize<int32_t>({B_token});
         size_t idx = 0;
+        const auto& prefix_sharing = _kernel._prefix_sharing;
         for (size_t i = 0; i < past_lens.size(0); i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
             auto kv_len = past_lens.ptr<int32_t>()[i] + q_len;
             auto block_number_start = block_indices_begins.ptr<int32_t>()[i];
             auto block_offset_start = kv_len - q_len;
+            // the scheduler may map the shared prefix of the follower to the same physical blocks as the leader,
+            // such blocks are written only once
+            auto leader = prefix_sharing.get_leader(i);
+            auto shared_len = prefix_sharing.get_shared_blocks(i) * static_cast<int32_t>(_helper._block_size);
+            const auto* leader_blocks =
+                leader < 0 ? nullptr : block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[leader];
             for (int32_t j = 0; j < q_len; j++) {
                 auto block_offset = block_offset_start + j;
-                auto block_number =
-                    block_indices.ptr<int32_t>()[block_number_start + block_offset / _helper._block_size];
+                auto block_id = block_offset / _helper._block_size;
+                auto block_number = block_indices.ptr<int32_t>()[block_number_start + block_id];
+                if (j < shared_len && block_number == leader_blocks[block_id]) {
+                    _slot_mapping.ptr<int32_t>()[idx++] = -1;
+                    continue;
+                }
                 _slot_mapping.ptr<int32_t>()[idx++] =
                     block_number * _helper._block_size + block_offset % _helper._block_size;
             }
@@ -2187,6 +2254,13 @@ struct AttentionExecutor : public PagedAttentionExecutor {
                                       _helper._block_rotation_coefficient_scratch);
         }
 
+        // the scores are accumulated per sequence and can't be taken from the leader
+        if (output_score) {
+            _kernel._prefix_sharing.clear();
+        } else {
+            _kernel._prefix_sharing.reset(q, k, v, past_lens, subsequence_begins, _helper._block_size);
+        }
+
         concat_pastkv(k, v, k_cache, v_cache, past_lens, subsequence_begins, block_indices, block_indices_begins);
 
         _kernel(q,
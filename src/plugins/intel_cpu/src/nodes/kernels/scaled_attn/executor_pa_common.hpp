@@ -5,9 +5,15 @@
 
 #include <xbyak/xbyak.h>
 
+#include <algorithm>
+#include <common/primitive_hashing_utils.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <openvino/core/type/element_type.hpp>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -54,6 +60,106 @@ struct PagedAttnQuantParams {
     bool is_sage_attn = false;
 };
 
+// Detects the sequences of a batch which start with the same prompt prefix (e.g. a common system prompt).
+// The attention result of a token depends only on the tokens before it, so the prefix blocks are computed once by
+// the first sequence owning them (leader) and the results are copied to the other sequences (followers).
+// Only the first tokens of the sequences (past_lens == 0) and the full blocks are considered.
+struct PrefixSharing {
+private:
+    std::vector<int32_t> leaders;                // leader sequence index or -1 if the sequence shares nothing
+    std::vector<int32_t> shared_blocks;          // number of leading query blocks taken from the leader
+    std::unordered_map<size_t, int32_t> owners;  // hash of the prefix up to a block -> the first sequence owning it
+    size_t followers_num = 0;
+
+    static size_t hash_rows(const ov::intel_cpu::PlainTensor& t, size_t begin, size_t count, size_t seed) {
+        const auto row_size = t.m_strides[0] * t.m_element_size;
+        std::string_view rows(static_cast<const char*>(t.ptr_v(begin)), row_size * count);
+        return dnnl::impl::hash_combine(seed, std::hash<std::string_view>{}(rows));
+    }
+
+    static bool equal_rows(const ov::intel_cpu::PlainTensor& t, size_t lhs, size_t rhs, size_t count) {
+        const auto row_size = t.m_strides[0] * t.m_element_size;
+        return std::memcmp(t.ptr_v(lhs), t.ptr_v(rhs), row_size * count) == 0;
+    }
+
+public:
+    void reset(const ov::intel_cpu::PlainTensor& query,
+               const ov::intel_cpu::PlainTensor& key,
+               const ov::intel_cpu::PlainTensor& value,
+               const ov::intel_cpu::PlainTensor& past_lens,
+               const ov::intel_cpu::PlainTensor& subsequence_begins,
+               size_t block_size) {
+        const auto seq_count = static_cast<int32_t>(past_lens.m_dims[0]);
+        leaders.assign(seq_count, -1);
+        shared_blocks.assign(seq_count, 0);
+        owners.clear();
+        followers_num = 0;
+        if (!query.is_dense() || !key.is_dense() || !value.is_dense()) {
+            return;
+        }
+        const auto* begins = subsequence_begins.ptr<int32_t>();
+        auto is_candidate = [&](int32_t i) {
+            return past_lens.ptr<int32_t>()[i] == 0 && begins[i + 1] - begins[i] >= static_cast<int32_t>(block_size);
+        };
+        int32_t candidates = 0;
+        for (int32_t i = 0; i < seq_count; i++) {
+            candidates += is_candidate(i) ? 1 : 0;
+        }
+        if (candidates < 2) {
+            return;
+        }
+
+        for (int32_t i = 0; i < seq_count; i++) {
+            if (!is_candidate(i)) {
+                continue;
+            }
+            const auto begin = static_cast<size_t>(begins[i]);
+            const auto full_blocks = static_cast<size_t>(begins[i + 1] - begins[i]) / block_size;
+            // the key rows are enough to find a candidate, the match is confirmed by the comparison of q, k and v
+            size_t hash = 0;
+            int32_t leader = -1;
+            size_t matched = 0;
+            for (size_t blk = 0; blk < full_blocks; blk++) {
+                hash = hash_rows(key, begin + blk * block_size, block_size, hash);
+                auto it = owners.find(hash);
+                if (it == owners.end()) {
+                    owners.emplace(hash, i);
+                } else if (matched == blk) {
+                    leader = it->second;
+                    matched = blk + 1;
+                }
+            }
+            if (leader < 0) {
+                continue;
+            }
+            const auto leader_begin = static_cast<size_t>(begins[leader]);
+            const auto matched_len = matched * block_size;
+            if (equal_rows(query, begin, leader_begin, matched_len) &&
+                equal_rows(key, begin, leader_begin, matched_len) &&
+                equal_rows(value, begin, leader_begin, matched_len)) {
+                leaders[i] = leader;
+                shared_blocks[i] = static_cast<int32_t>(matched);
+                followers_num++;
+            }
+        }
+    }
+    void clear() {
+        leaders.clear();
+        shared_blocks.clear();
+        owners.clear();
+        followers_num = 0;
+    }
+    [[nodiscard]] bool empty() const {
+        return followers_num == 0;
+    }
+    [[nodiscard]] int32_t get_leader(size_t seq) const {
+        return seq < leaders.size() ? leaders[seq] : -1;
+    }
+    [[nodiscard]] int32_t get_shared_blocks(size_t seq) const {
+        return seq < shared_blocks.size() ? shared_blocks[seq] : 0;
+    }
+};
+
 struct AttnWorkItem {
     int32_t batch_in_reorder;  // which batch in reorder buffer will be used
     int32_t batch_in_seq;      // batch idx in sequence
@@ -74,6 +180,7 @@ private:
     int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
     int32_t max_batch_in_reorder = 0;
     int32_t total_kv_len = 0;
+    size_t max_decode_q_len = 1;  // max q len of the sequences computed by the second token kernels
 
 public:
     void reset([[maybe_unused]] const ov::intel_cpu::PlainTensor& query,
@@ -81,24 +188,38 @@ public:
                const ov::intel_cpu::PlainTensor& subsequence_begins,
                const ov::intel_cpu::PlainTensor& block_indices,
                const ov::intel_cpu::PlainTensor& block_indices_begins,
-               size_t block_size) {
+               size_t block_size,
+               const PrefixSharing* prefix_sharing = nullptr,
+               size_t decode_q_len = 1) {
         attn_items.clear();
         reorder_items.clear();
         max_kv_len_in_reorder = 0;
         max_batch_in_reorder = 0;
         total_kv_len = 0;
+        // the per thread buffers of the second token kernels hold at most one block of query rows
+        max_decode_q_len = std::max(std::min(decode_q_len, block_size), static_cast<size_t>(1));
         auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
         for (int32_t i = 0; i < seq_cout; i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
             auto kv_len = past_lens.ptr<int32_t>()[i] + q_len;
             auto kv_len_in_block = static_cast<int32_t>(ov::intel_cpu::div_up(kv_len, block_size));
-            if (q_len == 1) {
-                attn_items.emplace_back(AttnWorkItem{0,     // batch_in_reorder
-                                                     i,     // batch_in_seq
-                                                     1ULL,  // q_len
+            // a few tokens on top of the cache (e.g. the draft tokens verification of the speculative decoding) are
+            // computed by the second token kernels with causal mask, so the whole cache is not reordered
+            if (q_len <= static_cast<int32_t>(max_decode_q_len)) {
+                attn_items.emplace_back(AttnWorkItem{0,      // batch_in_reorder
+                                                     i,      // batch_in_seq
+                                                     q_len,  // q_len
                                                      // kv_len in blocks, used in the sort function
                                                      kv_len_in_block - 1});
             } else {
+                // the query blocks shared with the leader are not computed, the whole sequence is skipped if it is
+                // identical to the prefix of the leader
+                auto shared_q_blocks = prefix_sharing ? prefix_sharing->get_shared_blocks(i) : 0;
+                auto attn_sub_work_count = static_cast<int32_t>(ov::intel_cpu::div_up(q_len, block_size));
+                if (shared_q_blocks == attn_sub_work_count) {
+                    total_kv_len += kv_len;
+                    continue;
+                }
                 auto reorder_sub_work_count = kv_len_in_block;
                 max_kv_len_in_reorder = std::max(max_kv_len_in_reorder, kv_len);
                 for (int32_t block_id = 0; block_id < reorder_sub_work_count; block_id++) {
@@ -113,8 +234,7 @@ public:
                 }
 
                 // workitems for attention
-                auto attn_sub_work_count = static_cast<int32_t>(ov::intel_cpu::div_up(q_len, block_size));
-                for (int32_t block_id = 0; block_id < attn_sub_work_count; block_id++) {
+                for (int32_t block_id = shared_q_blocks; block_id < attn_sub_work_count; block_id++) {
                     attn_items.emplace_back(AttnWorkItem{
                         max_batch_in_reorder,  // batch_in_reorder
                         i,                     // batch_in_seq
@@ -139,6 +259,9 @@ public:
     [[nodiscard]] size_t reorder_work_size() const {
         return reorder_items.size();
     }
+    [[nodiscard]] size_t get_max_decode_q_len() const {
+        return max_decode_q_len;
+    }
     [[nodiscard]] size_t get_reorder_max_batch_size() const {
         return static_cast<size_t>(max_batch_in_reorder);
     }
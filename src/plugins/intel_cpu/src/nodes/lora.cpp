@@ -4,13 +4,18 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "common/cpu_memcpy.h"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "node.h"
@@ -19,13 +24,107 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+// the inputs of the node, the adapter indices are present in the multi-adapter (pooled) form only
+constexpr size_t MAIN_FLOW = 0;
+constexpr size_t LORA_INPUT = 1;
+constexpr size_t MATRIX_A = 2;
+constexpr size_t ALPHA = 3;
+constexpr size_t MATRIX_B = 4;
+constexpr size_t ADAPTER_INDICES = 5;
+
+// The grouped gemm reads the adapter matrices once per row and does not block the rows, so it wins only for the few
+// rows per batch item of the decode (including the draft tokens of the speculative decoding). The longer sequences
+// (prefill) are computed by the oneDNN matmuls of the inner graph, where the gather cost is amortized over the rows.
+constexpr size_t maxGroupedGemmSeqLen = 8;
+
+/**
+ * Checks that the body of the multi-adapter LoRA is the plain low-rank gemm over the matrices gathered by the adapter
+ * index of each batch item: main + ((X * gather(A)^T) * gather(alpha)) * gather(B)^T. The transpositions of A and B
+ * are returned, the gathered alpha has to be [batch, 1, rank].
+ */
+bool parseGroupedGemmBody(const std::shared_ptr<const ov::Model>& body, bool& transposeA, bool& transposeB) {
+    const auto& params = body->get_parameters();
+    if (params.size() != ADAPTER_INDICES + 1 || body->get_results().size() != 1) {
+        return false;
+    }
+    auto isParameter = [&params](const ov::Output<ov::Node>& output, size_t idx) {
+        return output.get_node() == params[idx].get();
+    };
+    auto isGathered = [&](const ov::Output<ov::Node>& output, size_t idx) {
+        const auto* gather = ov::as_type<ov::op::util::GatherBase>(output.get_node());
+        return gather && gather->get_axis() == 0 && gather->get_batch_dims() == 0 &&
+               isParameter(gather->input_value(0), idx) && isParameter(gather->input_value(1), ADAPTER_INDICES);
+    };
+
+    const auto* add = ov::as_type<ov::op::v1::Add>(body->get_results()[0]->get_input_node_ptr(0));
+    if (!add) {
+        return false;
+    }
+    const size_t mainIdx = isParameter(add->input_value(0), MAIN_FLOW) ? 0 : 1;
+    const auto* matmul2 = ov::as_type<ov::op::v0::MatMul>(add->get_input_node_ptr(1 - mainIdx));
+    if (!isParameter(add->input_value(mainIdx), MAIN_FLOW) || !matmul2 || matmul2->get_transpose_a() ||
+        !isGathered(matmul2->input_value(1), MATRIX_B)) {
+        return false;
+    }
+    const auto* multiply = ov::as_type<ov::op::v1::Multiply>(matmul2->get_input_node_ptr(0));
+    if (!multiply) {
+        return false;
+    }
+    const size_t matmul1Idx = ov::is_type<ov::op::v0::MatMul>(multiply->get_input_node_ptr(0)) ? 0 : 1;
+    const auto* matmul1 = ov::as_type<ov::op::v0::MatMul>(multiply->get_input_node_ptr(matmul1Idx));
+    if (!matmul1 || matmul1->get_transpose_a() || !isParameter(matmul1->input_value(0), LORA_INPUT) ||
+        !isGathered(matmul1->input_value(1), MATRIX_A)) {
+        return false;
+    }
+    const auto alpha = multiply->input_value(1 - matmul1Idx);
+    const auto& alphaShape = alpha.get_partial_shape();
+    if (alphaShape.rank() != 3 || !alphaShape[1].compatible(1)) {
+        return false;
+    }
+    if (const auto* unsqueeze = ov::as_type<ov::op::v0::Unsqueeze>(alpha.get_node())) {
+        const auto axes = ov::as_type<ov::op::v0::Constant>(unsqueeze->get_input_node_ptr(1));
+        if (!axes || axes->cast_vector<int64_t>() != std::vector<int64_t>{1} ||
+            !isGathered(unsqueeze->input_value(0), ALPHA)) {
+            return false;
+        }
+    } else if (const auto* reshape = ov::as_type<ov::op::v1::Reshape>(alpha.get_node())) {
+        if (alphaShape[1] != 1 || !isGathered(reshape->input_value(0), ALPHA)) {
+            return false;
+        }
+    } else if (!isGathered(alpha, ALPHA)) {
+        return false;
+    }
+
+    if (params[LORA_INPUT]->get_partial_shape().rank() != 3 || params[MATRIX_A]->get_partial_shape().rank() != 3 ||
+        params[MATRIX_B]->get_partial_shape().rank() != 3 || params[ADAPTER_INDICES]->get_partial_shape().rank() != 1) {
+        return false;
+    }
+    transposeA = matmul1->get_transpose_b();
+    transposeB = matmul2->get_transpose_b();
+    return true;
+}
+
+}  // namespace
+
 bool LoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<ov::op::internal::LoraSubgraph>(op)) {
@@ -52,6 +151,7 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_groupedGemm = parseGroupedGemmBody(m_body, m_transposeA, m_transposeB);
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
@@ -68,7 +168,9 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        // the adapter indices are the only input which is not the data
+        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))
+                        ->cloneWithNewPrecision(i == ADAPTER_INDICES ? ov::element::i32 : mainInputPrc);
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -141,7 +243,129 @@ void LoRA::createPrimitive() {
     m_graph.Activate();
 }
 
+bool LoRA::isGroupedGemmApplicable() const {
+    if (!m_groupedGemm) {
+        return false;
+    }
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (!getSrcMemoryAtPort(i)->getDesc().hasLayoutType(LayoutType::ncsp)) {
+            return false;
+        }
+    }
+    const auto& mainDims = getSrcMemoryAtPort(MAIN_FLOW)->getStaticDims();
+    const auto& inputDims = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(MATRIX_A)->getStaticDims();
+    const auto& alphaDims = getSrcMemoryAtPort(ALPHA)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(MATRIX_B)->getStaticDims();
+    const auto& indicesDims = getSrcMemoryAtPort(ADAPTER_INDICES)->getStaticDims();
+
+    const size_t batch = inputDims[0];
+    if (inputDims[1] > maxGroupedGemmSeqLen) {
+        return false;
+    }
+    const size_t pool = aDims[0];
+    const size_t rank = m_transposeA ? aDims[1] : aDims[2];
+    const size_t k = m_transposeA ? aDims[2] : aDims[1];
+    const size_t n = m_transposeB ? bDims[1] : bDims[2];
+    // the other shapes (e.g. the broadcasted main flow) are left to the inner graph
+    return pool > 0 && indicesDims[0] == batch && inputDims[2] == k && bDims[0] == pool &&
+           (m_transposeB ? bDims[2] : bDims[1]) == rank && alphaDims[0] == pool &&
+           std::accumulate(alphaDims.begin() + 1, alphaDims.end(), size_t{1}, std::multiplies<>()) == rank &&
+           mainDims == VectorDims{batch, inputDims[1], n} && getDstMemoryAtPort(0)->getStaticDims() == mainDims;
+}
+
+template <typename T>
+void LoRA::executeGroupedGemm() {
+    const auto& inputDims = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(MATRIX_A)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(MATRIX_B)->getStaticDims();
+    const size_t batch = inputDims[0];
+    const size_t seqLen = inputDims[1];
+    const size_t k = inputDims[2];
+    const size_t pool = aDims[0];
+    const size_t rank = m_transposeA ? aDims[1] : aDims[2];
+    const size_t n = m_transposeB ? bDims[1] : bDims[2];
+    const size_t rows = batch * seqLen;
+
+    const auto* main = getSrcDataAtPortAs<const T>(MAIN_FLOW);
+    auto* dst = getDstDataAtPortAs<T>(0);
+    if (dst != main) {
+        cpu_memcpy(dst, main, rows * n * sizeof(T));
+    }
+    if (rank == 0 || rows == 0) {
+        return;
+    }
+
+    // the negative indices are counted from the end, as for Gather
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(ADAPTER_INDICES);
+    m_adapters.resize(batch);
+    for (size_t b = 0; b < batch; b++) {
+        const int64_t index = indices[b] < 0 ? indices[b] + static_cast<int64_t>(pool) : indices[b];
+        CPU_NODE_ASSERT(index >= 0 && index < static_cast<int64_t>(pool),
+                        "adapter index ",
+                        indices[b],
+                        " is out of the adapters pool of size ",
+                        pool);
+        m_adapters[b] = static_cast<size_t>(index);
+    }
+
+    const auto* x = getSrcDataAtPortAs<const T>(LORA_INPUT);
+    const auto* a = getSrcDataAtPortAs<const T>(MATRIX_A);
+    const auto* alpha = getSrcDataAtPortAs<const T>(ALPHA);
+    const auto* b = getSrcDataAtPortAs<const T>(MATRIX_B);
+    const size_t aStrides[2] = {m_transposeA ? k : 1, m_transposeA ? 1 : rank};  // rank, k
+    const size_t bStrides[2] = {m_transposeB ? rank : 1, m_transposeB ? 1 : n};  // n, rank
+
+    // shrink: the low-rank projection of every row with the matrices of the adapter of its batch item, the rows of a
+    // batch item are adjacent, so its adapter matrices stay in the cache
+    m_lowRankBuffer.resize(rows * rank);
+    auto* lowRank = m_lowRankBuffer.data();
+    parallel_for2d(rows, rank, [&](size_t row, size_t j) {
+        const size_t adapter = m_adapters[row / seqLen];
+        const T* xRow = x + row * k;
+        const T* aRow = a + adapter * rank * k + j * aStrides[0];
+        float acc = 0.0F;
+        for (size_t i = 0; i < k; i++) {
+            acc += static_cast<float>(xRow[i]) * static_cast<float>(aRow[i * aStrides[1]]);
+        }
+        lowRank[row * rank + j] = acc * static_cast<float>(alpha[adapter * rank + j]);
+    });
+
+    // expand: accumulate the delta into the main flow, the columns are split into blocks to use all the threads
+    // for the short sequences
+    constexpr size_t blockSize = 64;
+    const size_t blocks = (n + blockSize - 1) / blockSize;
+    parallel_for2d(rows, blocks, [&](size_t row, size_t block) {
+        const size_t adapter = m_adapters[row / seqLen];
+        const float* lowRankRow = lowRank + row * rank;
+        const T* bAdapter = b + adapter * rank * n;
+        T* dstRow = dst + row * n;
+        for (size_t col = block * blockSize; col < std::min(n, (block + 1) * blockSize); col++) {
+            float acc = 0.0F;
+            for (size_t j = 0; j < rank; j++) {
+                acc += lowRankRow[j] * static_cast<float>(bAdapter[col * bStrides[0] + j * bStrides[1]]);
+            }
+            dstRow[col] = static_cast<T>(static_cast<float>(dstRow[col]) + acc);
+        }
+    });
+}
+
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (isGroupedGemmApplicable()) {
+        switch (getSrcMemoryAtPort(MAIN_FLOW)->getDesc().getPrecision()) {
+        case ov::element::f32:
+            executeGroupedGemm<float>();
+            return;
+        case ov::element::bf16:
+            executeGroupedGemm<ov::bfloat16>();
+            return;
+        case ov::element::f16:
+            executeGroupedGemm<ov::float16>();
+            return;
+        default:
+            break;
+        }
+    }
     m_graph.Infer();
 }
 
@@ -39,7 +39,17 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    bool isGroupedGemmApplicable() const;
+    template <typename T>
+    void executeGroupedGemm();
+
     std::shared_ptr<const ov::Model> m_body;
+    // the multi-adapter body is a plain gather + low-rank gemm, so it is computed in one pass without the inner graph
+    bool m_groupedGemm = false;
+    bool m_transposeA = true;
+    bool m_transposeB = true;
+    std::vector<size_t> m_adapters;
+    std::vector<float> m_lowRankBuffer;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
 };
@@ -215,7 +215,7 @@ void Lrn::prepareParams() {
         return std::make_shared<DnnlExecutorLegacy>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedPrimitivesCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     CPU_NODE_ASSERT(execPtr, "Primitive descriptor was not found.");
@@ -543,7 +543,7 @@ void Pooling::prepareParams() {
             return std::make_shared<DnnlExecutorLegacy>(first_desc);
         };
 
-        auto cache = context->getParamsCache();
+        auto cache = context->getSharedPrimitivesCache();
         auto result = cache->getOrCreate(key, builder);
 
         dnnlExecPtr = result.first;
@@ -324,7 +324,7 @@ void Reorder::createReorderPrimitive(const DnnlMemoryDescPtr& srcDesc, const Dnn
     CPU_NODE_ASSERT(src_desc.get_ndims() == dst_desc.get_ndims(),
                     "OneDNN doesn't support reorder with different ranks.");
 
-    prim = getReorderPrim(context->getParamsCache(), getEngine(), src_desc, dst_desc);
+    prim = getReorderPrim(context->getSharedPrimitivesCache(), getEngine(), src_desc, dst_desc);
     CPU_NODE_ASSERT(prim, "could not create reorder primitive: unsupported reorder case.");
 
     selectedPD->setImplementationType(
@@ -1087,7 +1087,7 @@ void RNN::prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) {
     auto create = [&]() {
         Memory memory{getEngine(), m_initial_weights[idx]->getDescPtr(), m_initial_weights[idx]->getData()};
         MemoryPtr res_ptr = std::make_shared<Memory>(getEngine(), new_desc);
-        node::Reorder::reorderData(memory, *res_ptr, context->getParamsCache());
+        node::Reorder::reorderData(memory, *res_ptr, context->getSharedPrimitivesCache());
         return res_ptr;
     };
 
@@ -1401,7 +1401,7 @@ void RNN::prepareParams() {
         return descPtr ? std::make_shared<RnnDnnlExecutor>(descPtr) : nullptr;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedPrimitivesCache();
     auto result = cache->getOrCreate(key, builder);
     auto prevExecPtr = execPtr;
     execPtr = result.first;
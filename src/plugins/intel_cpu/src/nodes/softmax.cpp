@@ -223,7 +223,7 @@ void SoftMax::prepareParams() {
         return std::make_shared<DnnlExecutorLegacy>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedPrimitivesCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
@@ -152,6 +153,21 @@ struct SubgraphCodeGeneratorKey {
     std::shared_ptr<SubgraphAttrs> attrs = nullptr;
     uint32_t broadcasting_mask = 0;
 };
+
+// The lowered body depends only on the body, the memory descriptors and the blocked shapes of the inputs
+struct SubgraphLoweringKey : public SubgraphKey {
+    using SubgraphKey::SubgraphKey;
+};
+
+struct SubgraphLoweringResult {
+    // guards the lowering, so the identical Subgraphs lowered concurrently wait for the first one
+    std::mutex mutex;
+    snippets::op::Subgraph::LoweredState state;
+    // the node state filled by the data flow passes
+    std::map<size_t, size_t> broadcastable_inputs;
+    std::set<size_t> external_ptrs_idces;
+    InputRepackerMap input_repackers;
+};
 #endif
 
 struct SubgraphShapeInferResultKey {
@@ -399,14 +415,7 @@ ov::element::Type Subgraph::getRuntimePrecision() const {
 
 void Subgraph::createPrimitive() {
     if (!hasEmptyInputTensors()) {
-        const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-        input_num = config.inConfs.size();
-        output_num = config.outConfs.size();
-
-        initMemoryPtrs();
-        initPluginBlockedShapes();
-        initAttributes();
-        optimizeIR();
+        lower();
         // Init starts offsets should be after `prepareWeights`
         initStartOffsets();
     }
@@ -414,6 +423,38 @@ void Subgraph::createPrimitive() {
     Node::createPrimitive();
 }
 
+void Subgraph::lower() {
+    if (is_lowered) {
+        return;
+    }
+
+    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    input_num = config.inConfs.size();
+    output_num = config.outConfs.size();
+
+    initMemoryPtrs();
+    initPluginBlockedShapes();
+    initAttributes();
+
+    // The weights of the constant inputs are repacked to the memory of the node by the data flow passes
+    bool can_share_lowered_body = getConstantInputIndexes().empty();
+#ifdef SNIPPETS_DEBUG_CAPS
+    // The perf count passes depend on the node name
+    can_share_lowered_body &= subgraph_attrs->snippet->get_debug_config().perf_count_mode ==
+                              snippets::DebugCapsConfig::PerfCountMode::Disabled;
+#endif  // SNIPPETS_DEBUG_CAPS
+    if (can_share_lowered_body) {
+        optimizeIRShared();
+    } else {
+        optimizeIR();
+    }
+    is_lowered = true;
+}
+
+bool Subgraph::canBeLoweredConcurrently() const {
+    return !hasEmptyInputTensors() && getConstantInputIndexes().empty();
+}
+
 void Subgraph::initMemoryPtrs() {
     srcMemPtrs.resize(input_num);
     dstMemPtrs.resize(output_num);
@@ -762,6 +803,37 @@ void Subgraph::optimizeIR() {
                                            control_flow_passes);
 }
 
+void Subgraph::optimizeIRShared() {
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
+    const auto& cache = context->getSnippetsParamsCache();
+    const auto result =
+        cache->getOrCreate(SubgraphLoweringKey(subgraph_attrs, in_shapes), [](const SubgraphLoweringKey&) {
+            return std::make_shared<SubgraphLoweringResult>();
+        });
+    const auto& lowering = result.first;
+    const auto& snippet = subgraph_attrs->snippet;
+    const auto cpu_config = ov::as_type_ptr<CPURuntimeConfig>(snippet->get_runtime_configurator()->get_config());
+
+    std::lock_guard<std::mutex> lock(lowering->mutex);
+    if (!lowering->state.linear_ir) {
+        optimizeIR();
+        lowering->state = snippet->get_lowered_state();
+        lowering->broadcastable_inputs = broadcastable_inputs;
+        lowering->external_ptrs_idces = external_ptrs_idces;
+        lowering->input_repackers = cpu_config->input_repackers;
+        return;
+    }
+
+    snippet->set_lowered_state(lowering->state);
+    broadcastable_inputs = lowering->broadcastable_inputs;
+    external_ptrs_idces = lowering->external_ptrs_idces;
+    cpu_config->input_repackers = lowering->input_repackers;
+    is_lowered_body_shared = true;
+#else
+    optimizeIR();
+#endif
+}
+
 void Subgraph::prepareParams() {
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     const auto& cache = context->getSnippetsParamsCache();
@@ -47,6 +47,17 @@ public:
     void createPrimitive() override;
     void prepareParams() override;
 
+    // Applies the data flow and control flow transformations to the body if they have not been applied yet.
+    // Is called by createPrimitive, but may be called in advance for the Subgraphs which can be lowered concurrently
+    void lower();
+    // The Subgraph does not depend on the constant inputs computed by the other nodes, so it may be lowered
+    // once the memory is allocated regardless of the state of the other nodes
+    bool canBeLoweredConcurrently() const;
+    // The body was not transformed by this node, but taken from the identical Subgraph lowered before
+    bool isLoweredBodyShared() const {
+        return is_lowered_body_shared;
+    }
+
     bool canBeInPlace() const override;
     bool created() const override;
 
@@ -63,6 +74,8 @@ private:
     void initStartOffsets();
     void initPluginBlockedShapes() const;
     void optimizeIR();
+    // Takes the lowered body from the identical Subgraph lowered before or lowers the body and shares it
+    void optimizeIRShared();
 
     snippets::op::Subgraph::BlockedShapeVector getSnippetsBlockedShapes() const;
     std::pair<std::vector<ov::element::Type>, std::vector<ov::element::Type>> getIOPrecisions() const;
@@ -105,6 +118,8 @@ private:
     std::set<size_t> external_ptrs_idces;
 
     bool is_dynamic = false;
+    bool is_lowered = false;
+    bool is_lowered_body_shared = false;
     // Input shapes that are used in PrepareParams and ShapeInfer to avoid frequent memory allocation
     mutable std::vector<VectorDims> in_shapes;
 
@@ -175,7 +175,7 @@ void Transpose::prepareParams() {
         auto dstMemPtr = getDstMemoryAtPort(0);
         auto dstDesc = dstMemPtr->getDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
         auto srcDesc = dnnl::memory::desc(dstDesc.get_dims(), dstDesc.get_data_type(), memory::format_tag::acdb);
-        auto result = getReorderPrim(context->getParamsCache(), getEngine(), srcDesc, dstDesc);
+        auto result = getReorderPrim(context->getSharedPrimitivesCache(), getEngine(), srcDesc, dstDesc);
         CPU_NODE_ASSERT(result, "reorder primitive descriptor was not found.");
         prim = result;
 
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.m_count == 0) {
+        return;
+    }
+    if (other.m_counts.size() > m_counts.size()) {
+        m_counts.resize(other.m_counts.size(), 0);
+    }
+    for (size_t i = 0; i < other.m_counts.size(); i++) {
+        m_counts[i] += other.m_counts[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    const auto rank = std::max<uint64_t>(
+        1,
+        static_cast<uint64_t>(std::ceil(std::clamp(percent, 0.0, 100.0) / 100.0 * static_cast<double>(m_count))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < m_counts.size(); i++) {
+        seen += m_counts[i];
+        if (seen >= rank) {
+            // the bucket bound may exceed the largest recorded value
+            return std::min(bucketUpperBound(i), m_max);
+        }
+    }
+    return m_max;
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> LatencyHistogram::buckets() const {
+    std::vector<std::pair<uint64_t, uint64_t>> result;
+    for (size_t i = 0; i < m_counts.size(); i++) {
+        if (m_counts[i] != 0) {
+            result.emplace_back(bucketUpperBound(i), m_counts[i]);
+        }
+    }
+    return result;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < 2 * subBuckets) {
+        // the buckets below 2 * subBuckets hold a single value each
+        return index;
+    }
+    const auto shift = index / subBuckets - 1;
+    const auto subBucket = index % subBuckets + subBuckets;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+namespace {
+
+void dumpHistogram(std::ostream& os,
+                   const NodeLatencyRecord& record,
+                   const char* stage,
+                   const LatencyHistogram& histogram) {
+    if (histogram.count() == 0) {
+        return;
+    }
+    const auto us = [](uint64_t ns) {
+        return static_cast<double>(ns) / 1000.0;
+    };
+    os << record.name << ';' << record.type << ';' << record.execType << ';' << stage << ';' << histogram.count()
+       << ';' << us(histogram.min()) << ';' << us(histogram.mean()) << ';' << us(histogram.percentile(50.0)) << ';'
+       << us(histogram.percentile(90.0)) << ';' << us(histogram.percentile(99.0)) << ';'
+       << us(histogram.percentile(99.9)) << ';' << us(histogram.max()) << ';';
+    const char* separator = "";
+    for (const auto& bucket : histogram.buckets()) {
+        os << separator << bucket.first << ':' << bucket.second;
+        separator = " ";
+    }
+    os << '\n';
+}
+
+}  // namespace
+
+std::string dumpLatencyProfiles(const std::vector<NodeLatencyRecord>& records) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    os << "node_name;node_type;exec_type;stage;count;min_us;mean_us;p50_us;p90_us;p99_us;p99.9_us;max_us;buckets\n";
+    for (const auto& record : records) {
+        dumpHistogram(os, record, "execute", record.profile.execute);
+        dumpHistogram(os, record, "shape_infer", record.profile.shapeInfer);
+        dumpHistogram(os, record, "prepare_params", record.profile.prepareParams);
+    }
+    return os.str();
+}
+
+}  // namespace ov::intel_cpu
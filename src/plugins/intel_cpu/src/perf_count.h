@@ -4,9 +4,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <optional>
 #include <ratio>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ov::intel_cpu {
 
@@ -58,7 +65,131 @@ public:
     }
 };
 
+/**
+ * The histogram of the latencies in nanoseconds with the buckets of the constant relative precision (HDR style):
+ * every power of two range is split into the equal sub-buckets, so any percentile is reported within 1/16 of the
+ * recorded value. The buckets are allocated on demand up to the largest recorded value.
+ *
+ * Is not thread safe, the latencies of the node are recorded by the thread executing the graph
+ */
+class LatencyHistogram {
+public:
+    void record(uint64_t value) {
+        const auto index = bucketIndex(value);
+        if (index >= m_counts.size()) {
+            m_counts.resize(index + 1, 0);
+        }
+        m_counts[index]++;
+        m_count++;
+        m_sum += value;
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+    }
+
+    void merge(const LatencyHistogram& other);
+
+    [[nodiscard]] uint64_t count() const {
+        return m_count;
+    }
+    [[nodiscard]] uint64_t min() const {
+        return m_count == 0 ? 0 : m_min;
+    }
+    [[nodiscard]] uint64_t max() const {
+        return m_max;
+    }
+    [[nodiscard]] uint64_t mean() const {
+        return m_count == 0 ? 0 : m_sum / m_count;
+    }
+
+    /**
+     * @return the upper bound of the bucket holding the given percentile (0 - 100) of the recorded values
+     */
+    [[nodiscard]] uint64_t percentile(double percent) const;
+
+    /**
+     * @return the upper bounds of the non-empty buckets with the number of the values in them
+     */
+    [[nodiscard]] std::vector<std::pair<uint64_t, uint64_t>> buckets() const;
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < subBuckets) {
+            return static_cast<size_t>(value);
+        }
+        size_t shift = 0;
+        while ((value >> shift) >= 2 * subBuckets) {
+            shift++;
+        }
+        return (shift + 1) * subBuckets + static_cast<size_t>((value >> shift) - subBuckets);
+    }
+
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    static constexpr uint64_t subBuckets = 16;
+
+    std::vector<uint64_t> m_counts;
+    uint64_t m_count = 0;
+    uint64_t m_sum = 0;
+    uint64_t m_min = std::numeric_limits<uint64_t>::max();
+    uint64_t m_max = 0;
+};
+
+/**
+ * The latencies of the node recorded across the inferences, the shape inference and the preparation of the
+ * parameters of the dynamic nodes are recorded separately from the execution
+ */
+struct NodeLatencyProfile {
+    LatencyHistogram execute;
+    LatencyHistogram shapeInfer;
+    LatencyHistogram prepareParams;
+
+    void merge(const NodeLatencyProfile& other) {
+        execute.merge(other.execute);
+        shapeInfer.merge(other.shapeInfer);
+        prepareParams.merge(other.prepareParams);
+    }
+};
+
+struct NodeLatencyRecord {
+    std::string name;
+    std::string type;
+    std::string execType;
+    NodeLatencyProfile profile;
+};
+
+/**
+ * Dumps the latency profiles of the nodes in the format of the CPU_LATENCY_HISTOGRAMS_DUMP property: a ';' separated
+ * table with the header line and a line per each non-empty histogram
+ *     node_name;node_type;exec_type;stage;count;min_us;mean_us;p50_us;p90_us;p99_us;p99.9_us;max_us;buckets
+ * where stage is one of "execute", "shape_infer" and "prepare_params" and buckets is the space separated list of the
+ * <upper bound in ns>:<count> pairs of the non-empty buckets of the histogram
+ */
+std::string dumpLatencyProfiles(const std::vector<NodeLatencyRecord>& records);
+
+class LatencyHelper {
+    LatencyHistogram& histogram;
+    std::chrono::high_resolution_clock::time_point start;
+
+public:
+    explicit LatencyHelper(LatencyHistogram& latencies)
+        : histogram(latencies),
+          start(std::chrono::high_resolution_clock::now()) {}
+
+    ~LatencyHelper() {
+        const auto finish = std::chrono::high_resolution_clock::now();
+        histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+    }
+
+    LatencyHelper(const LatencyHelper&) = delete;
+    LatencyHelper& operator=(const LatencyHelper&) = delete;
+};
+
 }  // namespace ov::intel_cpu
 
 #define GET_PERF(_node)    std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter()))
 #define PERF(_node, _need) auto pc = (_need) ? GET_PERF(_node) : nullptr;
+#define LATENCY(_profile, _stage)                                   \
+    std::optional<LatencyHelper> latency_##_stage;                  \
+    if (auto* latency_profile_##_stage = (_profile)) {              \
+        latency_##_stage.emplace(latency_profile_##_stage->_stage); \
+    }
@@ -227,7 +227,11 @@ static std::string getDeviceFullName() {
     return brand_string;
 }
 
-Plugin::Plugin() : deviceFullName(getDeviceFullName()), specialSetup(new CPUSpecialSetup) {
+Plugin::Plugin()
+    : deviceFullName(getDeviceFullName()),
+      m_sharedWeights(std::make_shared<SocketsWeights>()),
+      m_kvCachePool(std::make_shared<KVCachePool>()),
+      specialSetup(new CPUSpecialSetup) {
     set_device_name("CPU");
     // Initialize Xbyak::util::Cpu object on Pcore for hybrid cores machine
     get_executor_manager()->execute_task_by_streams_executor(ov::hint::SchedulingCoreType::PCORE_ONLY, [] {
@@ -249,6 +253,17 @@ static bool streamsSet(const ov::AnyMap& config) {
     return config.find(ov::num_streams.name()) != config.end();
 }
 
+static void checkModelConfig(const ov::AnyMap& config) {
+    // the KV cache pool is shared by all the models compiled by the plugin, so its budgets can not be set per model
+    for (const auto& name : {ov::intel_cpu::kv_cache_memory_budget.name(),
+                             ov::intel_cpu::kv_cache_offload_budget.name(),
+                             ov::intel_cpu::kv_cache_offload_dir.name()}) {
+        if (config.count(name) != 0) {
+            OPENVINO_THROW("The property ", name, " can only be set for the plugin, not for the compiled model");
+        }
+    }
+}
+
 void Plugin::get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model) {
     int streams_set = config.streams;
     int streams = 0;
@@ -343,6 +358,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.applyRtInfo(cloned_model);
+    checkModelConfig(config);
     conf.readProperties(config, modelType);
 
     Transformations transformations(cloned_model, conf);
@@ -392,7 +408,22 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    return std::make_shared<CompiledModel>(cloned_model,
+                                           shared_from_this(),
+                                           conf,
+                                           false,
+                                           nullptr,
+                                           std::vector<PackedWeights>{},
+                                           get_shared_weights(),
+                                           m_kvCachePool);
+}
+
+std::shared_ptr<SocketsWeights> Plugin::get_shared_weights() const {
+    const auto& core = get_core();
+    if (!core || !core->get_property(std::string{}, ov::enable_weights_deduplication)) {
+        return nullptr;
+    }
+    return m_sharedWeights;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -401,6 +432,9 @@ void Plugin::set_property(const ov::AnyMap& config) {
     streamsExplicitlySetForEngine = streamsSet(config);
 
     engConfig.readProperties(config);
+    m_kvCachePool->setBudget(engConfig.kvCacheMemoryBudget);
+    m_kvCachePool->setOffloadBudget(engConfig.kvCacheOffloadBudget);
+    m_kvCachePool->setOffloadDirectory(engConfig.kvCacheOffloadDir);
 }
 
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options) const {
@@ -457,6 +491,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
     if (name == ov::hint::execution_mode) {
         return engConfig.executionMode;
     }
+    if (name == ov::compilation_num_threads) {
+        return static_cast<decltype(ov::compilation_num_threads)::value_type>(engConfig.compilationThreads);
+    }
     if (name == ov::internal::compiled_model_runtime_properties.name()) {
         auto model_runtime_properties = ov::Any(m_compiled_model_runtime_properties);
         return decltype(ov::internal::compiled_model_runtime_properties)::value_type(
@@ -559,6 +596,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             RW_property(ov::value_cache_precision.name()),
             RW_property(ov::key_cache_group_size.name()),
             RW_property(ov::value_cache_group_size.name()),
+            RW_property(ov::compilation_num_threads.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -576,6 +614,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             ov::PropertyName{ov::internal::caching_with_mmap.name(), ov::PropertyMutability::RO},
 #endif
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::cache_writer.name(), ov::PropertyMutability::WO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
                              ov::PropertyMutability::RO}};
@@ -757,11 +796,22 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
         loaded_from_cache = it->second.as<bool>();
         _config.erase(it);
     }
+    checkModelConfig(_config);
     conf.readProperties(_config, modelType);
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.get_packed_weights(),
+                                                          get_shared_weights(),
+                                                          m_kvCachePool);
+    // prebuild the executors for the shapes the model had been inferred with before the export, the import does not
+    // wait for it
+    compiled_model->warm_up_async(deserializer.get_shape_profile());
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
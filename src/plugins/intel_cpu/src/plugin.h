@@ -9,6 +9,7 @@
 #include <string>
 
 #include "config.h"
+#include "kv_cache_pool.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -19,6 +20,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "utils/serialize.hpp"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -70,6 +72,11 @@ private:
 
     ov::Any get_ro_property(const std::string& name, const ov::AnyMap& options) const;
 
+    /**
+     * @brief Returns the weights shared between the compiled models if the weights deduplication is enabled in the Core
+     */
+    std::shared_ptr<SocketsWeights> get_shared_weights() const;
+
     static void get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model);
     static void calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported = false);
     Config engConfig;
@@ -78,6 +85,10 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
+    // the repacked weights identified by their content, shared by all the compiled models of the plugin
+    std::shared_ptr<SocketsWeights> m_sharedWeights;
+    // the KV cache memory of the stateful models of all the compiled models of the plugin
+    KVCachePool::Ptr m_kvCachePool;
 
     std::shared_ptr<void> specialSetup;
 };
@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_profile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/partial_shape.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// the bounds of the interval and the powers of two between them
+std::vector<size_t> expandInterval(size_t lower, size_t upper) {
+    std::vector<size_t> values{lower};
+    for (size_t value = 1; value < upper; value <<= 1) {
+        if (value > lower) {
+            values.push_back(value);
+        }
+    }
+    if (upper != lower) {
+        values.push_back(upper);
+    }
+    return values;
+}
+
+std::vector<ShapeProfile::InputShapes> expandBucket(const std::vector<ov::PartialShape>& bucket) {
+    using Interval = std::pair<size_t, size_t>;
+    std::vector<Interval> intervals;
+    for (const auto& shape : bucket) {
+        OPENVINO_ASSERT(shape.rank().is_static(), "The shape bucket must not have a dynamic rank: ", shape);
+        for (const auto& dim : shape) {
+            OPENVINO_ASSERT(dim.get_max_length() >= 0, "The shape bucket dimension must be bounded: ", shape);
+            const Interval interval{dim.get_min_length(), dim.get_max_length()};
+            if (dim.is_dynamic() && std::find(intervals.begin(), intervals.end(), interval) == intervals.end()) {
+                intervals.push_back(interval);
+            }
+        }
+    }
+
+    std::vector<std::vector<size_t>> values;
+    values.reserve(intervals.size());
+    for (const auto& interval : intervals) {
+        values.push_back(expandInterval(interval.first, interval.second));
+    }
+
+    // iterate over all the combinations of the interval values
+    std::vector<ShapeProfile::InputShapes> combinations;
+    std::vector<size_t> indices(intervals.size(), 0);
+    while (true) {
+        ShapeProfile::InputShapes inputShapes;
+        inputShapes.reserve(bucket.size());
+        for (const auto& shape : bucket) {
+            ov::Shape staticShape;
+            staticShape.reserve(shape.size());
+            for (const auto& dim : shape) {
+                if (dim.is_static()) {
+                    staticShape.push_back(dim.get_length());
+                    continue;
+                }
+                const Interval interval{dim.get_min_length(), dim.get_max_length()};
+                const auto idx =
+                    std::distance(intervals.begin(), std::find(intervals.begin(), intervals.end(), interval));
+                staticShape.push_back(values[idx][indices[idx]]);
+            }
+            inputShapes.push_back(std::move(staticShape));
+        }
+        combinations.push_back(std::move(inputShapes));
+
+        size_t i = 0;
+        for (; i < indices.size(); ++i) {
+            if (++indices[i] < values[i].size()) {
+                break;
+            }
+            indices[i] = 0;
+        }
+        if (i == indices.size()) {
+            break;
+        }
+    }
+    return combinations;
+}
+
+}  // namespace
+
+bool ShapeProfile::record(const InputShapes& shapes) {
+    if (isFull()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_shapes.size() >= m_capacity || std::find(m_shapes.begin(), m_shapes.end(), shapes) != m_shapes.end()) {
+        return false;
+    }
+    m_shapes.push_back(shapes);
+    if (m_shapes.size() >= m_capacity) {
+        m_full.store(true, std::memory_order_release);
+    }
+    return true;
+}
+
+std::vector<ShapeProfile::InputShapes> ShapeProfile::get() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_shapes;
+}
+
+size_t ShapeProfile::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_shapes.size();
+}
+
+std::vector<ShapeProfile::InputShapes> parseShapeBuckets(const std::string& str, size_t capacity) {
+    std::vector<ShapeProfile::InputShapes> buckets;
+    std::stringstream ss(str);
+    std::string bucketStr;
+    while (std::getline(ss, bucketStr, ';')) {
+        std::vector<ov::PartialShape> bucket;
+        size_t begin = bucketStr.find('[');
+        while (begin != std::string::npos) {
+            const auto end = bucketStr.find(']', begin);
+            OPENVINO_ASSERT(end != std::string::npos, "Unclosed bracket in the shape bucket: ", bucketStr);
+            bucket.emplace_back(bucketStr.substr(begin, end - begin + 1));
+            begin = bucketStr.find('[', end);
+        }
+        if (bucket.empty()) {
+            continue;
+        }
+        for (auto& inputShapes : expandBucket(bucket)) {
+            if (std::find(buckets.begin(), buckets.end(), inputShapes) != buckets.end()) {
+                continue;
+            }
+            OPENVINO_ASSERT(buckets.size() < capacity,
+                            "The shape buckets are expanded into more than ",
+                            capacity,
+                            " input shapes combinations");
+            buckets.push_back(std::move(inputShapes));
+        }
+    }
+    return buckets;
+}
+
+}  // namespace ov::intel_cpu
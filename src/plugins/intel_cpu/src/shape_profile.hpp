@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Thread safe collection of the distinct input shapes combinations a dynamic model has been inferred with.
+ * The collection is stored in the exported model blob, so the shape specialized executors can be prebuilt on import.
+ */
+class ShapeProfile {
+public:
+    using InputShapes = std::vector<ov::Shape>;
+
+    static constexpr size_t defaultCapacity = 64;
+
+    explicit ShapeProfile(size_t capacity = defaultCapacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Adds the input shapes combination to the profile unless it is already there or the profile is full
+     * @return true if the combination has been added
+     */
+    bool record(const InputShapes& shapes);
+
+    [[nodiscard]] std::vector<InputShapes> get() const;
+
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] bool isFull() const {
+        return m_full.load(std::memory_order_acquire);
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<InputShapes> m_shapes;
+    size_t m_capacity;
+    std::atomic<bool> m_full{false};
+};
+
+/**
+ * @brief Parses the shape buckets definition (see ov::intel_cpu::shape_buckets) into the list of the distinct static
+ * input shapes combinations
+ * @param capacity is the maximum number of the combinations the buckets may be expanded into
+ */
+std::vector<ShapeProfile::InputShapes> parseShapeBuckets(const std::string& str,
+                                                         size_t capacity = ShapeProfile::defaultCapacity);
+
+}  // namespace ov::intel_cpu
@@ -891,7 +891,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    // the LoRA node computes the adapters gathered from the pools by the batch items with the grouped gemm
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion, true);
 
     manager.run_passes(model);
 }
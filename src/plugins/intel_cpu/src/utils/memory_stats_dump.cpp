@@ -17,6 +17,7 @@
 #    include <fstream>
 
 #    include "debug_capabilities.h"
+#    include "memory_allocator.h"
 #    include "memory_stats_dump.hpp"
 
 namespace ov::intel_cpu {
@@ -47,6 +48,19 @@ static void dumpStatistics(std::ostream& os,
         for (size_t i = 0; i < scratchpads.size(); ++i) {
             os << "Scratchpad " << i << " size: " << scratchpads[i]->size() << " bytes\n\n";
         }
+
+        if (const auto& allocator = ctx->getMemoryAllocator()) {
+            const auto statistics = allocator->getStatistics();
+            os << "Memory allocator mode: " << allocator->getMode() << "\n";
+            os << "Allocations: " << statistics.allocations << "\n";
+            os << "Allocated size: " << statistics.allocated_size << " bytes\n";
+            os << "Peak allocated size: " << statistics.peak_allocated_size << " bytes\n";
+            os << "Huge pages size: " << statistics.huge_pages_size << " bytes\n";
+            os << "Transparent huge pages size: " << statistics.transparent_huge_pages_size << " bytes\n";
+            os << "Huge pages fallbacks: " << statistics.huge_pages_fallbacks << "\n";
+            os << "NUMA bound size: " << statistics.numa_bound_size << " bytes\n";
+            os << "NUMA bind failures: " << statistics.numa_bind_failures << "\n\n";
+        }
     }
     os << "Weights cache statistics\n";
     auto weights_statistics = weights_cache.dumpStatistics();
@@ -86,6 +100,19 @@ static void dumpStatisticsCSV(std::ofstream& os,
         for (size_t i = 0; i < scratchpads.size(); ++i) {
             os << i << ";" << scratchpads[i]->size() << ";;;;;\n";
         }
+
+        if (const auto& allocator = ctx->getMemoryAllocator()) {
+            const auto statistics = allocator->getStatistics();
+            os << ";;;;;;\n";
+            os << "Memory allocator stats;" << allocator->getMode() << ";;;;;\n";
+            os << "Allocations [-];Allocated size [bytes];Peak allocated size [bytes];Huge pages size [bytes];"
+                  "Transparent huge pages size [bytes];Huge pages fallbacks [-];NUMA bound size [bytes];"
+                  "NUMA bind failures [-]\n";
+            os << statistics.allocations << ";" << statistics.allocated_size << ";" << statistics.peak_allocated_size
+               << ";" << statistics.huge_pages_size << ";" << statistics.transparent_huge_pages_size << ";"
+               << statistics.huge_pages_fallbacks << ";" << statistics.numa_bound_size << ";"
+               << statistics.numa_bind_failures << "\n";
+        }
     }
     auto weights_statistics = weights_cache.dumpStatistics();
     if (!weights_statistics.empty()) {
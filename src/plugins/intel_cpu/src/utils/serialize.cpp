@@ -5,14 +5,17 @@
 #include "serialize.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <istream>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -22,20 +25,192 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "shape_profile.hpp"
 #include "utils/codec_xor.hpp"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+std::string shape_to_string(const ov::Shape& shape) {
+    std::stringstream ss;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        ss << (i ? "," : "") << shape[i];
+    }
+    return ss.str();
+}
+
+ov::Shape shape_from_string(const std::string& str) {
+    ov::Shape shape;
+    std::stringstream ss(str);
+    std::string dim;
+    while (std::getline(ss, dim, ',')) {
+        shape.push_back(std::stoull(dim));
+    }
+    return shape;
+}
+
+void write_shape_profile(pugi::xml_node& root, const std::vector<ShapeProfile::InputShapes>& shape_profile) {
+    if (shape_profile.empty()) {
+        return;
+    }
+    auto profile_node = root.append_child("shape_profile");
+    for (const auto& input_shapes : shape_profile) {
+        auto entry_node = profile_node.append_child("entry");
+        for (const auto& shape : input_shapes) {
+            entry_node.append_child("input").append_attribute("shape").set_value(shape_to_string(shape).c_str());
+        }
+    }
+}
+
+std::vector<ShapeProfile::InputShapes> read_shape_profile(const pugi::xml_node& root) {
+    std::vector<ShapeProfile::InputShapes> shape_profile;
+    for (const auto& entry_node : root.child("shape_profile").children("entry")) {
+        ShapeProfile::InputShapes input_shapes;
+        for (const auto& input_node : entry_node.children("input")) {
+            input_shapes.push_back(shape_from_string(input_node.attribute("shape").as_string()));
+        }
+        shape_profile.push_back(std::move(input_shapes));
+    }
+    return shape_profile;
+}
+
+// the prepacked weights are stored page aligned so the memory mapped blob may be used without copying
+constexpr uint64_t packed_weights_page_size = 4096;
+// the minimal alignment of the weights data required to use it in place
+constexpr size_t packed_weights_alignment = 64;
+
+uint64_t align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::string to_hex(const std::vector<uint8_t>& data) {
+    static const char digits[] = "0123456789abcdef";
+    std::string str;
+    str.reserve(data.size() * 2);
+    for (const auto byte : data) {
+        str.push_back(digits[byte >> 4]);
+        str.push_back(digits[byte & 0xF]);
+    }
+    return str;
+}
+
+std::vector<uint8_t> from_hex(const std::string& str) {
+    OPENVINO_ASSERT(str.size() % 2 == 0, "[CPU] Invalid packed weights descriptor.");
+    std::vector<uint8_t> data(str.size() / 2);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(std::stoul(str.substr(2 * i, 2), nullptr, 16));
+    }
+    return data;
+}
+
+// The custom data layout is: [xml]['\0'][uint64 offset of the weights section from the custom data begin][padding]
+// [page aligned weights data]. The xml part contains the offsets of the weights inside the weights section.
+void write_packed_weights_info(pugi::xml_node& root, const std::vector<PackedWeights>& packed_weights) {
+    auto weights_node = root.append_child("packed_weights");
+    uint64_t offset = 0;
+    for (const auto& weights : packed_weights) {
+        offset = align_up(offset, packed_weights_page_size);
+        auto entry_node = weights_node.append_child("entry");
+        entry_node.append_attribute("key").set_value(weights.key_prefix.c_str());
+        entry_node.append_attribute("constant").set_value(weights.constant_name.c_str());
+        entry_node.append_attribute("desc").set_value(to_hex(weights.desc).c_str());
+        entry_node.append_attribute("offset").set_value(std::to_string(offset).c_str());
+        entry_node.append_attribute("size").set_value(std::to_string(weights.size).c_str());
+        offset += weights.size;
+    }
+}
+
+void write_padding(std::ostream& stream, uint64_t& pos, uint64_t alignment) {
+    static const char zeros[packed_weights_page_size] = {};
+    const auto padding = align_up(pos, alignment) - pos;
+    stream.write(zeros, static_cast<std::streamsize>(padding));
+    pos += padding;
+}
+
+void write_packed_weights_data(std::ostream& stream,
+                               std::streampos custom_data_begin,
+                               const std::vector<PackedWeights>& packed_weights) {
+    stream.put('\0');
+    auto pos = static_cast<uint64_t>(stream.tellp());
+    const uint64_t section_begin = align_up(pos + sizeof(uint64_t), packed_weights_page_size);
+    const uint64_t section_offset = section_begin - static_cast<uint64_t>(custom_data_begin);
+    stream.write(reinterpret_cast<const char*>(&section_offset), sizeof section_offset);
+    pos += sizeof section_offset;
+    for (const auto& weights : packed_weights) {
+        write_padding(stream, pos, packed_weights_page_size);
+        stream.write(static_cast<const char*>(weights.data), static_cast<std::streamsize>(weights.size));
+        pos += weights.size;
+    }
+}
+
+// The weights are used in place if they are held by the mapped blob and properly aligned, otherwise they are copied.
+std::vector<PackedWeights> read_packed_weights(const pugi::xml_node& root,
+                                               const char* custom_data,
+                                               size_t custom_data_size,
+                                               const std::shared_ptr<void>& holder) {
+    std::vector<PackedWeights> packed_weights;
+    const auto weights_node = root.child("packed_weights");
+    if (!weights_node) {
+        return packed_weights;
+    }
+
+    const size_t info_size = strnlen(custom_data, custom_data_size) + 1;
+    OPENVINO_ASSERT(info_size + sizeof(uint64_t) <= custom_data_size, "[CPU] The packed weights section is corrupted.");
+    uint64_t section_offset = 0;
+    std::memcpy(&section_offset, custom_data + info_size, sizeof section_offset);
+
+    for (const auto& entry_node : weights_node.children("entry")) {
+        PackedWeights weights;
+        weights.key_prefix = entry_node.attribute("key").as_string();
+        weights.constant_name = entry_node.attribute("constant").as_string();
+        weights.desc = from_hex(entry_node.attribute("desc").as_string());
+        const uint64_t offset = std::stoull(entry_node.attribute("offset").as_string());
+        weights.size = std::stoull(entry_node.attribute("size").as_string());
+        OPENVINO_ASSERT(section_offset + offset + weights.size <= custom_data_size,
+                        "[CPU] The packed weights section is corrupted.");
+
+        const char* data = custom_data + section_offset + offset;
+        if (holder && reinterpret_cast<uintptr_t>(data) % packed_weights_alignment == 0) {
+            weights.data = data;
+            weights.holder = holder;
+        } else {
+            auto buffer = std::make_shared<ov::AlignedBuffer>(weights.size, packed_weights_alignment);
+            std::memcpy(buffer->get_ptr(), data, weights.size);
+            weights.data = buffer->get_ptr();
+            weights.holder = std::move(buffer);
+        }
+        packed_weights.push_back(std::move(weights));
+    }
+    return packed_weights;
+}
+
+}  // namespace
+
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn)
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 std::vector<ShapeProfile::InputShapes> shape_profile,
+                                 std::vector<PackedWeights> packed_weights)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
+          [shape_profile = std::move(shape_profile), packed_weights = std::move(packed_weights)](std::ostream& stream) {
+              // the page alignment of the weights relies on the absolute stream position
+              const auto custom_data_begin = stream.tellp();
+              const bool with_packed_weights = !packed_weights.empty() && custom_data_begin != std::streampos(-1);
+
               pugi::xml_document xml_doc;
               pugi::xml_node root = xml_doc.append_child("cnndata");
               root.append_child("outputs");
+              write_shape_profile(root, shape_profile);
+              if (with_packed_weights) {
+                  write_packed_weights_info(root, packed_weights);
+              }
               xml_doc.save(stream);
+              if (with_packed_weights) {
+                  write_packed_weights_data(stream, custom_data_begin, packed_weights);
+              }
           },
           encrypt_fn) {};
 
@@ -77,7 +252,10 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
     }
 }
 
-void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
+void ModelDeserializer::set_info(pugi::xml_node& root, [[maybe_unused]] std::shared_ptr<ov::Model>& model) {
+    // the profile is optional, the blobs exported from the static models or before any inference don't contain it
+    m_shape_profile = read_shape_profile(root);
+}
 
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     std::visit(
@@ -108,8 +286,9 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Read model input/output precisions.
     pugi::xml_document xml_in_out_doc;
     if (hdr.custom_data_size > 0LU) {
+        // the xml part may be followed by the binary packed weights section
         auto res = xml_in_out_doc.load_buffer(buffer_base + hdr.custom_data_offset,
-                                              hdr.custom_data_size,
+                                              strnlen(buffer_base + hdr.custom_data_offset, hdr.custom_data_size),
                                               pugi::parse_default,
                                               pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, "[CPU] Could to deserialize custom data.");
@@ -145,6 +324,8 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xml_in_out_doc.child("cnndata");
     set_info(root, model);
+    m_packed_weights =
+        read_packed_weights(root, buffer_base + hdr.custom_data_offset, hdr.custom_data_size, model_buffer);
 }
 
 void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
@@ -170,8 +351,8 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     model_stream.seekg(hdr.custom_data_offset);
 
     pugi::xml_document xmlInOutDoc;
+    std::string xmlInOutString;
     if (hdr.custom_data_size > 0) {
-        std::string xmlInOutString;
         xmlInOutString.resize(hdr.custom_data_size);
         model_stream.read(const_cast<char*>(xmlInOutString.c_str()), hdr.custom_data_size);
         auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
@@ -215,5 +396,7 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     set_info(root, model);
+    // there is no mapped memory to refer to, so the packed weights are copied
+    m_packed_weights = read_packed_weights(root, xmlInOutString.data(), xmlInOutString.size(), nullptr);
 };
 }  // namespace ov::intel_cpu
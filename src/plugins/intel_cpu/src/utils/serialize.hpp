@@ -3,6 +3,8 @@
 //
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <istream>
 #include <memory>
@@ -10,19 +12,39 @@
 #include <pugixml.hpp>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "shape_profile.hpp"
 #include "utils/codec_xor.hpp"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Prepacked weights stored in the blob page aligned, so they can be put into the weights cache on import
+ * without repacking and, if the blob is memory mapped, without copying.
+ * The weights cache key is stored without the trailing address of the source constant, since the address is only
+ * known after the import. The constant is identified by its friendly name instead.
+ */
+struct PackedWeights {
+    std::string key_prefix;
+    std::string constant_name;
+    std::vector<uint8_t> desc;  // serialized dnnl memory descriptor
+    const void* data = nullptr;
+    size_t size = 0;
+    std::shared_ptr<void> holder;  // keeps the data alive
+};
+
 class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {});
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             std::vector<ShapeProfile::InputShapes> shape_profile = {},
+                             std::vector<PackedWeights> packed_weights = {});
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -49,8 +71,23 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the input shapes combinations the model had been inferred with before the export
+     */
+    [[nodiscard]] const std::vector<ShapeProfile::InputShapes>& get_shape_profile() const {
+        return m_shape_profile;
+    }
+
+    /**
+     * @brief Returns the prepacked weights stored in the blob. In case of the memory mapped blob the data refers
+     * directly to the mapped memory
+     */
+    [[nodiscard]] const std::vector<PackedWeights>& get_packed_weights() const {
+        return m_packed_weights;
+    }
+
 protected:
-    static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
+    void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
     void process_model(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& model_buffer);
     void process_model(std::shared_ptr<ov::Model>& model, std::reference_wrapper<std::istream> model_stream);
@@ -59,6 +96,8 @@ protected:
     ModelBuilder m_model_builder;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
+    std::vector<ShapeProfile::InputShapes> m_shape_profile;
+    std::vector<PackedWeights> m_packed_weights;
 };
 
 }  // namespace ov::intel_cpu
@@ -5,10 +5,12 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -37,33 +39,39 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
-WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
-                                                               const std::function<MemoryPtr(void)>& create,
-                                                               bool valid) {
+std::pair<WeightsSharing::MemoryInfo::Ptr, MemoryPtr> WeightsSharing::findOrCreateInfo(
+    const std::string& key,
+    const std::function<MemoryPtr(void)>& create,
+    bool valid) {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
-    {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
 
-        auto isCached = [&]() -> bool {
-            if (found == sharedWeights.end()) {
-                return false;
-            }
-            ptr = found->second;
-            if (!ptr) {
-                return false;
-            }
-            newPtr = ptr->sharedMemory.lock();
-            return static_cast<bool>(newPtr);
-        };
-
-        if (!isCached()) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+    auto isCached = [&]() -> bool {
+        if (found == sharedWeights.end()) {
+            return false;
+        }
+        ptr = found->second;
+        if (!ptr) {
+            return false;
         }
+        newPtr = ptr->sharedMemory.lock();
+        return static_cast<bool>(newPtr);
+    };
+
+    if (!isCached()) {
+        newPtr = create();
+        ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+        sharedWeights[key] = ptr;
     }
+    return {ptr, newPtr};
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
+                                                               const std::function<MemoryPtr(void)>& create,
+                                                               bool valid) {
+    auto [ptr, newPtr] = findOrCreateInfo(key, create, valid);
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                               : std::unique_lock<std::mutex>(ptr->guard),
@@ -71,6 +79,93 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
                                           newPtr);
 }
 
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
+                                                               const std::function<std::string(void)>& contentKey,
+                                                               const MemoryCPtr& source,
+                                                               const std::function<MemoryPtr(void)>& create) {
+    if (!contentStore) {
+        return findOrCreate(key, create);
+    }
+    auto lookup = [&]() -> std::pair<MemoryInfo::Ptr, MemoryPtr> {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = sharedWeights.find(key);
+        if (found == sharedWeights.end() || !found->second) {
+            return {};
+        }
+        return {found->second, found->second->sharedMemory.lock()};
+    };
+    auto [ptr, newPtr] = lookup();
+    if (!newPtr) {
+        // the content key is computed only on a local miss, since hashing the weights is not free. Neither the hashing
+        // nor the content store lookup holds the guard, so the other nodes of the model are not blocked by them
+        newPtr = contentStore->findOrCreateContent(contentKey(), source, create);
+        // the object is registered under the local key as well, so it is visible to get() and snapshot()
+        std::lock_guard<std::mutex> lock(guard);
+        auto& info = sharedWeights[key];
+        auto registered = info ? info->sharedMemory.lock() : nullptr;
+        if (registered) {
+            // registered by a concurrent call meanwhile
+            newPtr = std::move(registered);
+        } else {
+            info = std::make_shared<MemoryInfo>(newPtr, true);
+        }
+        ptr = info;
+    }
+    return std::make_shared<SharedMemory>(std::unique_lock<std::mutex>(ptr->guard, std::defer_lock), ptr, newPtr);
+}
+
+MemoryPtr WeightsSharing::findOrCreateContent(const std::string& contentKey,
+                                              const MemoryCPtr& source,
+                                              const std::function<MemoryPtr(void)>& create) {
+    // the entry is reserved under the store guard, while the creation and the comparison run under the guard of the
+    // entry only: the store is shared by all the compiled models, so they must not wait for each other's weights
+    MemoryInfo::Ptr info;
+    std::unique_lock<std::mutex> entryLock;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[contentKey];
+        if (found) {
+            info = found;
+        } else {
+            found = std::make_shared<MemoryInfo>(nullptr, false);
+            found->source = source;
+            info = found;
+            // the new entry is not visible to the others until the guard is released, so the lock is taken at once
+            entryLock = std::unique_lock<std::mutex>(info->guard);
+        }
+    }
+
+    if (!entryLock.owns_lock()) {
+        // waits for the creation of the entry by another thread
+        entryLock = std::unique_lock<std::mutex>(info->guard);
+        auto memory = info->sharedMemory.lock();
+        auto stored = info->source.lock();
+        // the hash is not a proof of the equality: the bytes are compared as the core weights store does. If the
+        // source of the cached object is gone, its content can't be verified, so the entry is replaced
+        if (memory && stored &&
+            (stored == source || (stored->getSize() == source->getSize() &&
+                                  std::memcmp(stored->getData(), source->getData(), source->getSize()) == 0))) {
+            return memory;
+        }
+        entryLock.unlock();
+        auto newPtr = create();
+        auto newInfo = std::make_shared<MemoryInfo>(newPtr, true);
+        newInfo->source = source;
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[contentKey];
+        // the entry may have been replaced by a concurrent miss meanwhile, the latest one stays
+        if (found == info) {
+            found = std::move(newInfo);
+        }
+        return newPtr;
+    }
+
+    auto newPtr = create();
+    info->sharedMemory = newPtr;
+    info->valid.store(true, std::memory_order_release);
+    return newPtr;
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -91,10 +186,31 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+std::vector<std::pair<std::string, MemoryPtr>> WeightsSharing::snapshot() const {
+    std::vector<std::pair<std::string, MemoryPtr>> retVal;
+
+    std::lock_guard<std::mutex> lock(guard);
+
+    retVal.reserve(sharedWeights.size());
+    for (const auto& item : sharedWeights) {
+        if (!item.second || !item.second->valid.load(std::memory_order_acquire)) {
+            continue;
+        }
+        if (auto memory = item.second->sharedMemory.lock()) {
+            retVal.emplace_back(item.first, std::move(memory));
+        }
+    }
+
+    return retVal;
+}
+
+SocketsWeights::SocketsWeights() : SocketsWeights(nullptr) {}
+
+SocketsWeights::SocketsWeights(const std::shared_ptr<SocketsWeights>& contentStores) {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] =
+            std::make_shared<WeightsSharing>(contentStores ? (*contentStores)[socket_id] : WeightsSharing::Ptr{});
     }
 }
 
@@ -110,6 +226,28 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+size_t WeightsSharing::memorySize() const {
+    // the same memory object may be registered under several keys
+    std::unordered_set<const IMemory*> counted;
+    size_t size = 0;
+    for (const auto& item : snapshot()) {
+        if (counted.insert(item.second.get()).second) {
+            size += item.second->getDesc().getCurrentMemSize();
+        }
+    }
+    return size;
+}
+
+size_t SocketsWeights::memorySize() const {
+    size_t size = 0;
+    for (const auto& item : _cache_map) {
+        if (item.second) {
+            size += item.second->memorySize();
+        }
+    }
+    return size;
+}
+
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
@@ -39,6 +39,8 @@ class WeightsSharing {
         std::mutex guard;
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
+        // the memory the object is created from, is used to verify the content hits of the content store
+        std::weak_ptr<const IMemory> source;
     };
 
 public:
@@ -51,6 +53,13 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param contentStore the store of the memory objects identified by their content, which is shared between the
+     * compiled models
+     */
+    explicit WeightsSharing(Ptr contentStore) : contentStore(std::move(contentStore)) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -71,15 +80,49 @@ public:
                                    const std::function<MemoryPtr(void)>& create,
                                    bool valid = true);
 
+    /**
+     * @brief Same as findOrCreate, but the memory object is also looked up in the content store, so the identical
+     * weights of the different compiled models share the same memory
+     * @param contentKey computes the key identifying the content of the memory object regardless of its origin, is
+     * called only if the object is not found by the local key
+     * @param source the memory the object is created from, the content hit is taken only if the source bytes are equal
+     */
+    SharedMemory::Ptr findOrCreate(const std::string& key,
+                                   const std::function<std::string(void)>& contentKey,
+                                   const MemoryCPtr& source,
+                                   const std::function<MemoryPtr(void)>& create);
+
+    [[nodiscard]] bool hasContentStore() const {
+        return static_cast<bool>(contentStore);
+    }
+
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Returns the alive and completely initialized cached memory objects along with their keys
+     */
+    std::vector<std::pair<std::string, MemoryPtr>> snapshot() const;
+
+    /**
+     * @brief Returns the size (in bytes) of the alive and completely initialized cached memory objects
+     */
+    [[nodiscard]] size_t memorySize() const;
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 protected:
+    std::pair<MemoryInfo::Ptr, MemoryPtr> findOrCreateInfo(const std::string& key,
+                                                           const std::function<MemoryPtr(void)>& create,
+                                                           bool valid);
+    MemoryPtr findOrCreateContent(const std::string& contentKey,
+                                  const MemoryCPtr& source,
+                                  const std::function<MemoryPtr(void)>& create);
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    Ptr contentStore;
 };
 
 /**
@@ -90,10 +133,19 @@ protected:
 class SocketsWeights {
 public:
     SocketsWeights();
+    /**
+     * @param contentStores the per socket content stores shared with the other compiled models (if not null)
+     */
+    explicit SocketsWeights(const std::shared_ptr<SocketsWeights>& contentStores);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    /**
+     * @brief Returns the size (in bytes) of the cached memory objects of all the sockets
+     */
+    [[nodiscard]] size_t memorySize() const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -2,12 +2,17 @@
 // SPDX-License-corer: Apache-2.0
 //
 
+#include <filesystem>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
@@ -114,6 +119,106 @@ const std::vector<ov::AnyMap> testing_property_for_enable_hyper_threading = {{ov
 const std::vector<ov::AnyMap> testing_property_for_enable_cpu_pinning = {{ov::hint::enable_cpu_pinning(true)},
                                                                          {ov::hint::enable_cpu_pinning(false)}};
 
+std::shared_ptr<ov::Model> MakeDynamicMatMulModel() {
+    ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 256})};
+    auto matmul_const = ov::test::utils::make_constant(ov::element::f32, {256, 128});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], matmul_const);
+    auto softmax = std::make_shared<ov::opset9::Softmax>(matmul);
+    return std::make_shared<ov::Model>(ov::OutputVector{softmax}, params, "DynamicMatMulModel");
+}
+
+const std::vector<ov::Shape> profile_shapes = {{1, 256}, {7, 256}, {32, 256}};
+
+void infer_shapes(ov::CompiledModel& compiled_model, const std::vector<ov::Shape>& shapes) {
+    auto request = compiled_model.create_infer_request();
+    for (const auto& shape : shapes) {
+        request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape));
+        request.infer();
+    }
+}
+
+uint64_t params_cache_misses(const ov::CompiledModel& compiled_model) {
+    return compiled_model.get_property(ov::intel_cpu::cpu_runtime_cache_statistics).at("misses");
+}
+
+// the executors of the shapes the model has been inferred with are built on import, before the first inference
+void check_warmed_up(ov::CompiledModel& compiled_model, uint64_t not_warmed_up_misses) {
+    const auto warm_up_misses = params_cache_misses(compiled_model);
+    EXPECT_GT(warm_up_misses, not_warmed_up_misses);
+    infer_shapes(compiled_model, profile_shapes);
+    EXPECT_EQ(params_cache_misses(compiled_model), warm_up_misses);
+}
+
+TEST(ExportImportShapeProfile, ImportedModelIsWarmedUp) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    const ov::AnyMap config{ov::num_streams(1)};
+    auto compiled_model = core.compile_model(MakeDynamicMatMulModel(), "CPU", config);
+
+    // no shapes are recorded before the inferences
+    uint64_t not_warmed_up_misses = 0;
+    {
+        std::stringstream exported_model;
+        compiled_model.export_model(exported_model);
+        auto imported_model = core.import_model(exported_model, "CPU", config);
+        not_warmed_up_misses = params_cache_misses(imported_model);
+    }
+
+    infer_shapes(compiled_model, profile_shapes);
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    auto imported_model = core.import_model(exported_model, "CPU", config);
+    check_warmed_up(imported_model, not_warmed_up_misses);
+}
+
+TEST(ExportImportShapeProfile, CacheEntryIsUpdated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto cache_dir = ov::test::utils::generateTestFilePrefix() + "_shape_profile_cache";
+    ov::Core core;
+    core.set_property(ov::cache_dir(cache_dir));
+    const ov::AnyMap config{ov::num_streams(1)};
+    const auto model = MakeDynamicMatMulModel();
+
+    uint64_t not_warmed_up_misses = 0;
+    {
+        // the cache entry is written right after the compilation and rewritten with the shapes by release_memory
+        auto compiled_model = core.compile_model(model, "CPU", config);
+        ASSERT_FALSE(compiled_model.get_property(ov::loaded_from_cache));
+        not_warmed_up_misses = params_cache_misses(compiled_model);
+        infer_shapes(compiled_model, profile_shapes);
+        compiled_model.release_memory();
+    }
+
+    auto cached_model = core.compile_model(model, "CPU", config);
+    ASSERT_TRUE(cached_model.get_property(ov::loaded_from_cache));
+    check_warmed_up(cached_model, not_warmed_up_misses);
+
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST(ExportImportShapeProfile, CacheEntryIsNotUpdatedOnDestruction) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto cache_dir = ov::test::utils::generateTestFilePrefix() + "_shape_profile_no_update_cache";
+    ov::Core core;
+    core.set_property(ov::cache_dir(cache_dir));
+    const ov::AnyMap config{ov::num_streams(1)};
+    const auto model = MakeDynamicMatMulModel();
+
+    uint64_t not_warmed_up_misses = 0;
+    {
+        auto compiled_model = core.compile_model(model, "CPU", config);
+        not_warmed_up_misses = params_cache_misses(compiled_model);
+        infer_shapes(compiled_model, profile_shapes);
+    }
+
+    // the release of the model does not export it, so the entry written by the compilation has no shapes
+    auto cached_model = core.compile_model(model, "CPU", config);
+    ASSERT_TRUE(cached_model.get_property(ov::loaded_from_cache));
+    EXPECT_EQ(params_cache_misses(cached_model), not_warmed_up_misses);
+
+    std::filesystem::remove_all(cache_dir);
+}
+
 INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                         ExportOptimalNumStreams,
                         ::testing::Combine(::testing::Values(std::string("CPU")),
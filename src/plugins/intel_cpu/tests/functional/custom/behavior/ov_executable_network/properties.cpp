@@ -6,9 +6,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -54,6 +60,7 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
         RO_property(ov::value_cache_group_size.name()),
+        RO_property(ov::compilation_num_threads.name()),
     };
 
     ov::Core ie;
@@ -225,6 +232,129 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckDynamicQuantizationGroupSi
     ASSERT_EQ(groupSize, 64);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCompilationNumThreads) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::compilation_num_threads(4));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    int32_t compilationThreads = 0;
+    OV_ASSERT_NO_THROW(compilationThreads = compiledModel.get_property(ov::compilation_num_threads));
+    ASSERT_EQ(compilationThreads, 4);
+
+    std::map<std::string, uint64_t> compileTimes;
+    OV_ASSERT_NO_THROW(compileTimes = compiledModel.get_property(ov::intel_cpu::compile_time_breakdown));
+    ASSERT_EQ(compileTimes.count("InitDescriptors"), 1);
+    ASSERT_EQ(compileTimes.count("CreatePrimitivesAndExecConstants"), 1);
+
+    ASSERT_THROW(core.set_property(deviceName, ov::compilation_num_threads(0)), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkParallelCompilationIsDeterministic) {
+    ov::Core core;
+    auto serialModel = core.compile_model(model, deviceName, ov::compilation_num_threads(1));
+    auto parallelModel = core.compile_model(model, deviceName, ov::compilation_num_threads(8));
+
+    auto serialRequest = serialModel.create_infer_request();
+    auto parallelRequest = parallelModel.create_infer_request();
+    for (const auto& input : model->inputs()) {
+        auto tensor = ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape());
+        serialRequest.set_tensor(input, tensor);
+        parallelRequest.set_tensor(input, tensor);
+    }
+    serialRequest.infer();
+    parallelRequest.infer();
+
+    for (const auto& output : model->outputs()) {
+        const auto expected = serialRequest.get_tensor(output);
+        const auto actual = parallelRequest.get_tensor(output);
+        ASSERT_EQ(expected.get_byte_size(), actual.get_byte_size());
+        ASSERT_EQ(std::memcmp(expected.data(), actual.data(), expected.get_byte_size()), 0);
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkWeightsDeduplicationKeepsResults) {
+    ov::Core core;
+    auto refModel = core.compile_model(model, deviceName);
+    core.set_property(ov::enable_weights_deduplication(true));
+    // the second model reuses the repacked weights of the first one
+    auto firstModel = core.compile_model(model->clone(), deviceName);
+    auto secondModel = core.compile_model(model->clone(), deviceName);
+
+    auto refRequest = refModel.create_infer_request();
+    auto firstRequest = firstModel.create_infer_request();
+    auto secondRequest = secondModel.create_infer_request();
+    for (const auto& input : model->inputs()) {
+        auto tensor = ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape());
+        refRequest.set_tensor(input, tensor);
+        firstRequest.set_tensor(input, tensor);
+        secondRequest.set_tensor(input, tensor);
+    }
+    refRequest.infer();
+    firstRequest.infer();
+    secondRequest.infer();
+
+    for (const auto& output : model->outputs()) {
+        const auto expected = refRequest.get_tensor(output);
+        for (auto* request : {&firstRequest, &secondRequest}) {
+            const auto actual = request->get_tensor(output);
+            ASSERT_EQ(expected.get_byte_size(), actual.get_byte_size());
+            ASSERT_EQ(std::memcmp(expected.data(), actual.data(), expected.get_byte_size()), 0);
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMaxMemory) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, deviceName, ov::num_streams(4));
+    uint64_t predictedPeak = 0;
+    OV_ASSERT_NO_THROW(predictedPeak = compiledModel.get_property(ov::intel_cpu::predicted_peak_memory));
+    ASSERT_GT(predictedPeak, 0);
+
+    // the streams share the graphs fitting into the limit
+    auto limitedModel = core.compile_model(model,
+                                           deviceName,
+                                           ov::num_streams(4),
+                                           ov::intel_cpu::max_memory(predictedPeak - 1));
+    uint64_t limitedPeak = 0;
+    OV_ASSERT_NO_THROW(limitedPeak = limitedModel.get_property(ov::intel_cpu::predicted_peak_memory));
+    ASSERT_LT(limitedPeak, predictedPeak);
+    // the graphs are dropped until the predicted peak fits into the limit
+    ASSERT_LE(limitedPeak, predictedPeak - 1);
+    OV_ASSERT_NO_THROW(limitedModel.create_infer_request().infer());
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::num_streams(4), ov::intel_cpu::max_memory(1)), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMaxMemoryDynamic) {
+    ov::Core core;
+    // the output of the first MatMul is the intermediate tensor allocated for the inferred shape
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 64});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{64, 64}, std::vector<float>(64 * 64, 0.01f));
+    auto first = std::make_shared<ov::op::v0::MatMul>(param, weights);
+    auto second = std::make_shared<ov::op::v0::MatMul>(first, weights);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{second}, ov::ParameterVector{param});
+
+    const uint64_t limit = 16 * 1024 * 1024;
+    auto compiledModel = core.compile_model(dynamicModel,
+                                            deviceName,
+                                            ov::num_streams(1),
+                                            ov::hint::inference_precision(ov::element::f32),
+                                            ov::intel_cpu::max_memory(limit));
+    auto request = compiledModel.create_infer_request();
+    auto infer = [&](size_t rows) {
+        ov::Tensor input(ov::element::f32, ov::Shape{rows, 64});
+        std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+        request.set_input_tensor(input);
+        request.infer();
+    };
+    OV_ASSERT_NO_THROW(infer(16));
+    // the intermediate tensor of 32MB does not fit into the limit
+    ASSERT_THROW(infer(128 * 1024), ov::Exception);
+    // the memory of the graph is released, so the model keeps working within the limit
+    OV_ASSERT_NO_THROW(infer(16));
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKVCachePrecision) {
     ov::Core core;
 
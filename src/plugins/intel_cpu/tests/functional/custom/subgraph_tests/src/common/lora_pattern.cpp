@@ -9,9 +9,11 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
 
 namespace ov {
 namespace test {
@@ -282,6 +284,124 @@ protected:
     static constexpr size_t num_channels = 64ul;
 };
 
+using LoraMultiAdapterParams = std::tuple<size_t,                 // adapters in the pool
+                                         size_t,                 // rank
+                                         std::vector<int32_t>>;  // adapter index of each batch item
+
+/**
+ * The multi-adapter LoRA: the matrices of the adapter of each batch item are gathered from the pools kept in the states,
+ * the CPU LoRA node computes such body with the grouped low-rank gemm
+ */
+class LoraMultiAdapterCPUTest : public SubgraphBaseTest, public testing::WithParamInterface<LoraMultiAdapterParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LoraMultiAdapterParams>& obj) {
+        const auto& [pool, rank, indices] = obj.param;
+        std::ostringstream result;
+        result << "pool=" << pool << "_rank=" << rank << "_indices=" << ov::test::utils::vec2str(indices);
+        return result.str();
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        std::tie(pool, rank, indices) = this->GetParam();
+
+        auto param_x = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape{-1, -1, K});
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape{N, K});
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_x, param_w, false, true);
+
+        // the pools: [pool, rank, K], [pool, rank] and [pool, N, rank]
+        ov::OutputVector pools;
+        ov::SinkVector assigns;
+        const std::vector<std::pair<ov::PartialShape, std::string>> pool_infos{{{-1, -1, K}, t6_name},
+                                                                               {{-1, -1}, t5_name},
+                                                                               {{-1, N, -1}, t4_name}};
+        for (const auto& [shape, name] : pool_infos) {
+            auto variable =
+                std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, netType, name});
+            auto read_value = std::make_shared<ov::op::v6::ReadValue>(variable);
+            assigns.push_back(std::make_shared<ov::op::v6::Assign>(read_value, variable));
+            pools.push_back(read_value);
+        }
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        auto a = std::make_shared<ov::op::v8::Gather>(pools[0], param_indices, axis);
+        auto alpha = std::make_shared<ov::op::v8::Gather>(pools[1], param_indices, axis);
+        auto b = std::make_shared<ov::op::v8::Gather>(pools[2], param_indices, axis);
+        auto unsqueeze_axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+        auto alpha_unsqueezed = std::make_shared<ov::op::v0::Unsqueeze>(alpha, unsqueeze_axis);
+
+        auto shrink = std::make_shared<ov::op::v0::MatMul>(param_x, a, false, true);
+        auto scaled = std::make_shared<ov::op::v1::Multiply>(shrink, alpha_unsqueezed);
+        auto expand = std::make_shared<ov::op::v0::MatMul>(scaled, b, false, true);
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, expand);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(tz)},
+                                               assigns,
+                                               ov::ParameterVector{param_x, param_w, param_indices});
+    }
+
+    void run_test() {
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        auto compiledReferenceModel = core->compile_model(function, ov::test::utils::DEVICE_TEMPLATE);
+        auto inferRequestRef = compiledReferenceModel.create_infer_request();
+
+        using ov::test::utils::InputGenerateData;
+        const auto batch = indices.size();
+        const auto& params = function->get_parameters();
+        const std::unordered_map<std::string, ov::Shape> pool_shapes{{t6_name, {pool, rank, K}},
+                                                                     {t5_name, {pool, rank}},
+                                                                     {t4_name, {pool, N, rank}}};
+        // the adapters are replaced between the inferences, as a serving runtime does, the decode and the prefill
+        // sequence lengths are computed by the grouped gemm and by the inner graph respectively
+        const std::vector<size_t> seq_lens{1, 5, 32};
+        for (size_t i = 0; i < seq_lens.size(); i++) {
+            const std::vector<ov::Tensor> input_tensors{
+                ov::test::utils::create_and_fill_tensor(netType,
+                                                        {batch, seq_lens[i], K},
+                                                        InputGenerateData{-1, 2, 100, 1}),
+                ov::test::utils::create_and_fill_tensor(netType, {N, K}, InputGenerateData{-1, 2, 100, 2}),
+                ov::Tensor(ov::element::i32, {batch}, indices.data())};
+            for (size_t j = 0; j < params.size(); j++) {
+                inferRequest.set_tensor(params[j], input_tensors[j]);
+                inferRequestRef.set_tensor(params[j], input_tensors[j]);
+            }
+
+            const auto seed = 3 + static_cast<int>(i);
+            auto&& refStates = inferRequestRef.query_state();
+            for (auto&& item : inferRequest.query_state()) {
+                auto tensor = ov::test::utils::create_and_fill_tensor(netType,
+                                                                      pool_shapes.at(item.get_name()),
+                                                                      InputGenerateData{-1, 2, 100, seed});
+                item.set_state(tensor);
+                auto itr = std::find_if(refStates.begin(), refStates.end(), [&](const ov::VariableState& state) {
+                    return state.get_name() == item.get_name();
+                });
+                ASSERT_FALSE(itr == refStates.end());
+                itr->set_state(tensor);
+            }
+
+            inferRequest.infer();
+            inferRequestRef.infer();
+            const auto& output = function->output(0);
+            ov::test::utils::compare(inferRequestRef.get_tensor(output), inferRequest.get_tensor(output), 1e-4, 1e-4);
+        }
+    }
+
+    static constexpr size_t K = 64ul;
+    static constexpr size_t N = 96ul;
+
+    size_t pool = 0;
+    size_t rank = 0;
+    std::vector<int32_t> indices;
+};
+
+TEST_P(LoraMultiAdapterCPUTest, CompareWithRefs) {
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+}
+
 TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     targetStaticShapes = {{{{1, 20, K}}, {{N, K}}}};
     run_test();
@@ -311,5 +431,18 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPU
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+// the adapters of the batch items differ, repeat and are counted from the end of the pool
+const std::vector<LoraMultiAdapterParams> multi_adapter_params{
+    {1, 4, {0}},
+    {2, 8, {1, 0}},
+    {3, 16, {2, 0, 2, 1}},
+    {4, 7, {3, -1, 0, 1, -4}},
+    {8, 32, {5, 5, 5}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoRA_CPU_MultiAdapter, LoraMultiAdapterCPUTest,
+                         ::testing::ValuesIn(multi_adapter_params),
+                         LoraMultiAdapterCPUTest::getTestCaseName);
+
 }  // namespace test
 }  // namespace ov
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <random>
+
 #include "common_test_utils/include/common_test_utils/ov_tensor_utils.hpp"
 #include "internal_properties.hpp"
 #include "openvino/core/type/float16.hpp"
@@ -309,38 +312,28 @@ public:
             size_t batch_size_in_sequences = 1;
             // The test here simulates pagedAttn calcuation with 1 subsequence
             // idx = 0 means 1st token calculation, idx > 0 means 2nd token calculation
-            int32_t total_blocks = intel_cpu::div_up(past_len_count, 32);
+            // the blocks hold the past tokens and the new ones, which may be several for the multi token decode
+            int32_t total_blocks = intel_cpu::div_up(past_len_count + static_cast<int32_t>(qkv_shape[0]), 32);
+            // test case here only has 1 block for prefill, but we allocate 2 blocks to simulate the vLLM case.
+            // To test whether we have overflow in kernels.
+            int32_t allocated_blocks = (idx == 0 && extendBlockIndices) ? total_blocks + 1 : total_blocks;
             ov::Tensor past_lens(ov::element::i32, {batch_size_in_sequences}),
                 subsequence_begins(ov::element::i32, {batch_size_in_sequences + 1}),
                 block_indices_begins(ov::element::i32, {batch_size_in_sequences + 1}),
-                block_indices(ov::element::i32, {static_cast<size_t>(total_blocks)});
+                block_indices(ov::element::i32, {static_cast<size_t>(allocated_blocks)});
             int32_t *past_lens_data = reinterpret_cast<int32_t*>(past_lens.data()),
                     *subsequence_begins_data = reinterpret_cast<int32_t*>(subsequence_begins.data()),
                     *block_indices_begins_data = reinterpret_cast<int32_t*>(block_indices_begins.data()),
                     *block_indices_data = reinterpret_cast<int32_t*>(block_indices.data());
             inputs.insert({function->get_parameters()[3], key_cache});
             inputs.insert({function->get_parameters()[4], value_cache});
-            if (idx == 0) {
-                past_lens_data[0] = 0;
-                subsequence_begins_data[0] = 0;
-                subsequence_begins_data[1] = targetInputStaticShapes[0][0];
-                block_indices_begins_data[0] = 0;
-                // test case here only has 1 block for prefill, but we allocate 2 blocks to simulate the vLLM case.
-                // To test whether we have overflow in kernels.
-                if (extendBlockIndices)
-                    block_indices_begins_data[1] = 2;
-                else
-                    block_indices_begins_data[1] = 1;
-                block_indices_data[0] = 0;
-            } else {
-                past_lens_data[0] = past_len_count;
-                subsequence_begins_data[0] = 0;
-                subsequence_begins_data[1] = targetInputStaticShapes[0][0];
-                block_indices_begins_data[0] = 0;
-                block_indices_begins_data[1] = total_blocks;
-                for (int32_t i = 0; i < total_blocks; i++) {
-                    block_indices_data[i] = i;
-                }
+            past_lens_data[0] = idx == 0 ? 0 : past_len_count;
+            subsequence_begins_data[0] = 0;
+            subsequence_begins_data[1] = targetInputStaticShapes[0][0];
+            block_indices_begins_data[0] = 0;
+            block_indices_begins_data[1] = allocated_blocks;
+            for (int32_t i = 0; i < allocated_blocks; i++) {
+                block_indices_data[i] = i;
             }
 
             inputs.insert({function->get_parameters()[5], past_lens});
@@ -698,6 +691,218 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSMatmulTest,
                                             ::testing::Values(true, false),
                                             ::testing::ValuesIn(additional_configs)),
                          PagedAttnTestBase::getTestCaseName);
+
+// The verification of the draft tokens of the speculative decoding: 2 to 8 new tokens on top of the cache are processed
+// by the second token kernels with the causal mask, the reference masks the keys after the past and the query position
+const std::vector<InputShapes> inputShapesMultiTokenDecode = {
+    {
+        // L1, B, H, S
+        {{-1, 1, 8, 64}, {{10, 1, 8, 64}, {2, 1, 8, 64}, {8, 1, 8, 64}, {5, 1, 8, 64}, {3, 1, 8, 64}}},
+        // B, L0, H, S
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {10, 1, 8, 64}, {12, 1, 8, 64}, {20, 1, 8, 64}, {25, 1, 8, 64}}},
+    },
+    {
+        // the new tokens cross the boundary of the cache blocks
+        // L1, B, H, S
+        {{-1, 1, 8, 64}, {{30, 1, 8, 64}, {4, 1, 8, 64}, {7, 1, 8, 64}, {8, 1, 8, 64}, {1, 1, 8, 64}}},
+        // B, L0, H, S
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {30, 1, 8, 64}, {34, 1, 8, 64}, {41, 1, 8, 64}, {49, 1, 8, 64}}},
+    }};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSMatmulTest_MultiTokenDecode,
+                         PagedAttnVSMatmulTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::f16),
+                                            ::testing::ValuesIn(inputShapesMultiTokenDecode),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(additional_configs)),
+                         PagedAttnTestBase::getTestCaseName);
+}  // namespace
+
+// The sequences of a batch starting with the same prompt share the attention of its full blocks: the first sequence
+// (leader) computes it, the other ones (followers) copy its output. The followers may also share the physical cache
+// blocks of the prefix with the leader, then only the leader writes them. The output of the batch and the next tokens
+// attending to the cache must be the same as when every sequence is computed alone.
+class PagedAttnPrefixSharingTest : public PagedAttnTestBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PagedAttnTestParams>& obj) {
+        const auto& [inType, inputShapes, sharedCacheBlocks, additional_config] = obj.param;
+        std::ostringstream result;
+        result << "Prc=" << inType << "_";
+        result << "SharedCacheBlocks=" << sharedCacheBlocks;
+        return result.str();
+    }
+
+    // the tokens are the parts of (seed, length), the same parts make the same rows of q, k and v
+    struct Sequence {
+        std::vector<std::pair<uint32_t, size_t>> tokens;
+        int32_t past_len;
+        std::vector<int32_t> blocks;
+    };
+
+    void SetUp() override {
+        const auto& [inType, inputShapes, sharedCacheBlocks, additional_config] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        rel_threshold = 1e-2f;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        if (inType == ElementType::bf16) {
+            configuration[ov::hint::inference_precision.name()] = ov::element::bf16;
+        }
+        configuration.insert(additional_config.begin(), additional_config.end());
+        function = get_model(inType, 64, 8);
+    }
+
+    static void fill_rows(ov::Tensor& tensor, size_t row, size_t rows, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        const auto row_size = tensor.get_shape()[1];
+        for (size_t i = row * row_size; i < (row + rows) * row_size; i++) {
+            const auto value = dist(gen);
+            if (tensor.get_element_type() == ov::element::f32) {
+                tensor.data<float>()[i] = value;
+            } else if (tensor.get_element_type() == ov::element::bf16) {
+                tensor.data<ov::bfloat16>()[i] = ov::bfloat16(value);
+            } else {
+                tensor.data<ov::float16>()[i] = ov::float16(value);
+            }
+        }
+    }
+
+    std::pair<ov::Tensor, ov::Tensor> create_caches(size_t block_nums) {
+        ov::Tensor keys, values;
+        for (const auto& input : compiledModel.inputs()) {
+            for (auto& name : input.get_names()) {
+                auto pshape = input.get_partial_shape();
+                pshape[0] = block_nums;
+                if (name.find("key_cache.") == 0) {
+                    keys = ov::Tensor(input.get_element_type(), pshape.get_shape());
+                    break;
+                } else if (name.find("value_cache.") == 0) {
+                    values = ov::Tensor(input.get_element_type(), pshape.get_shape());
+                    break;
+                }
+            }
+        }
+        return {keys, values};
+    }
+
+    ov::Tensor infer(const std::vector<Sequence>& sequences, const ov::Tensor& keys, const ov::Tensor& values) {
+        const auto& params = function->get_parameters();
+        const auto data_type = params[0]->get_element_type();
+        size_t total_tokens = 0;
+        size_t total_blocks = 0;
+        for (const auto& sequence : sequences) {
+            for (const auto& part : sequence.tokens) {
+                total_tokens += part.second;
+            }
+            total_blocks += sequence.blocks.size();
+        }
+        ov::Tensor q(data_type, {total_tokens, 8 * 64}), k(data_type, {total_tokens, 8 * 64}),
+            v(data_type, {total_tokens, 8 * 64});
+        ov::Tensor past_lens(ov::element::i32, {sequences.size()}),
+            subsequence_begins(ov::element::i32, {sequences.size() + 1}),
+            block_indices(ov::element::i32, {total_blocks}),
+            block_indices_begins(ov::element::i32, {sequences.size() + 1});
+        size_t row = 0;
+        size_t block = 0;
+        subsequence_begins.data<int32_t>()[0] = 0;
+        block_indices_begins.data<int32_t>()[0] = 0;
+        for (size_t i = 0; i < sequences.size(); i++) {
+            for (const auto& [seed, length] : sequences[i].tokens) {
+                fill_rows(q, row, length, seed * 3);
+                fill_rows(k, row, length, seed * 3 + 1);
+                fill_rows(v, row, length, seed * 3 + 2);
+                row += length;
+            }
+            for (auto block_index : sequences[i].blocks) {
+                block_indices.data<int32_t>()[block++] = block_index;
+            }
+            past_lens.data<int32_t>()[i] = sequences[i].past_len;
+            subsequence_begins.data<int32_t>()[i + 1] = static_cast<int32_t>(row);
+            block_indices_begins.data<int32_t>()[i + 1] = static_cast<int32_t>(block);
+        }
+
+        inputs.clear();
+        inputs.insert({params[0], q});
+        inputs.insert({params[1], k});
+        inputs.insert({params[2], v});
+        inputs.insert({params[3], keys});
+        inputs.insert({params[4], values});
+        inputs.insert({params[5], past_lens});
+        inputs.insert({params[6], subsequence_begins});
+        inputs.insert({params[7], block_indices});
+        inputs.insert({params[8], block_indices_begins});
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+        auto outputTensor = inferRequest.get_output_tensor(0);
+        ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+        outputTensor.copy_to(copy);
+        return copy;
+    }
+
+    // every sequence alone in its own blocks of the separate cache, so nothing is shared
+    ov::Tensor infer_unshared(const std::vector<Sequence>& sequences,
+                              const std::vector<std::vector<int32_t>>& blocks,
+                              const ov::Tensor& keys,
+                              const ov::Tensor& values) {
+        std::vector<ov::Tensor> outputs;
+        size_t total_rows = 0;
+        for (size_t i = 0; i < sequences.size(); i++) {
+            auto sequence = sequences[i];
+            sequence.blocks = blocks[i];
+            outputs.push_back(infer({sequence}, keys, values));
+            total_rows += outputs.back().get_shape()[0];
+        }
+        ov::Tensor result{outputs[0].get_element_type(), {total_rows, outputs[0].get_shape()[1]}};
+        size_t offset = 0;
+        for (const auto& output : outputs) {
+            std::memcpy(static_cast<uint8_t*>(result.data()) + offset, output.data(), output.get_byte_size());
+            offset += output.get_byte_size();
+        }
+        return result;
+    }
+};
+
+TEST_P(PagedAttnPrefixSharingTest, CompareWithUnshared) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto& [inType, inputShapes, sharedCacheBlocks, additional_config] = this->GetParam();
+    if (inType == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    prepare();
+    const size_t block_nums = 12;
+    const auto [keys, values] = create_caches(block_nums);
+    const auto [ref_keys, ref_values] = create_caches(block_nums);
+
+    // the prompts share 2 full blocks of 32 tokens, the last one is the same as the first one
+    const std::pair<uint32_t, size_t> prefix{1, 64}, tail0{2, 8}, tail1{3, 13};
+    const std::vector<std::vector<int32_t>> unshared_blocks = {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+    const std::vector<std::vector<int32_t>> shared_blocks = {{0, 1, 2}, {0, 1, 3}, {0, 1, 4}};
+    const auto& blocks = sharedCacheBlocks ? shared_blocks : unshared_blocks;
+    const std::vector<Sequence> prompts = {{{prefix, tail0}, 0, blocks[0]},
+                                           {{prefix, tail1}, 0, blocks[1]},
+                                           {{prefix, tail0}, 0, blocks[2]}};
+    auto actual = infer(prompts, keys, values);
+    auto expected = infer_unshared(prompts, unshared_blocks, ref_keys, ref_values);
+    ov::test::utils::compare(expected, actual, abs_threshold, rel_threshold);
+
+    // the next tokens attend to the prompts in the cache, including the prefix blocks written by the leader only
+    const std::vector<Sequence> next_tokens = {{{{4, 1}}, 72, blocks[0]},
+                                               {{{5, 1}}, 77, blocks[1]},
+                                               {{{6, 1}}, 72, blocks[2]}};
+    actual = infer(next_tokens, keys, values);
+    expected = infer_unshared(next_tokens, unshared_blocks, ref_keys, ref_values);
+    ov::test::utils::compare(expected, actual, abs_threshold, rel_threshold);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnPrefixSharingTest,
+                         PagedAttnPrefixSharingTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
+                                            ::testing::Values(InputShapes{}),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(ov::AnyMap{})),
+                         PagedAttnPrefixSharingTest::getTestCaseName);
 }  // namespace
 
 }  // namespace test
@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The structurally identical Subgraphs (e.g. the repeated blocks of a transformer) are lowered only once: the first
+// Subgraph runs the data flow and control flow transformations, the others take the copy of its lowered body.
+// With several compilation threads the Subgraphs are lowered concurrently, so the Subgraphs sharing the body wait for
+// the first one. The single layer tests do not cover the case when the lowered body is used by several nodes.
+
+//  -----  -----  -----        -----  -----
+//  | Q |  | K |  | V |        | A |  | B |
+//  -----  -----  -----        -----  -----
+//    |      |      |            |      |
+//  --------------  |          -----------
+//  |  MatMul 0  |  |          |   Add   |
+//  --------------  |          -----------
+//        |         |               |
+//  --------------  |          -----------
+//  |  Softmax   |  |          |Multiply |
+//  --------------  |          -----------
+//        |         |               |
+//  -----------------          -----------
+//  |   MatMul 1    |          |  Relu   |
+//  -----------------          -----------
+//        |                         |
+//   ----------                ----------
+//   | output |                | output |
+//   ----------                ----------
+//
+// The MHA and the eltwise blocks are repeated several times, each copy has its own inputs and outputs
+
+#include "common_test_utils/common_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+namespace ov {
+namespace test {
+
+typedef std::tuple<InputShape,  // MHA input shape
+                   InputShape,  // Eltwise input shape
+                   size_t       // Number of the block copies
+                   >
+    SubgraphSharedLoweringParams;
+
+class SubgraphSharedLoweringTest : public testing::WithParamInterface<SubgraphSharedLoweringParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SubgraphSharedLoweringParams>& obj) {
+        const auto& [mhaShape, eltwiseShape, blocks] = obj.param;
+        std::ostringstream results;
+        results << "MHA_IS=" << mhaShape << "_";
+        results << "Eltwise_IS=" << eltwiseShape << "_";
+        results << "blocks=" << blocks;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [mhaShape, eltwiseShape, blocks] = this->GetParam();
+        std::vector<InputShape> inputShapes;
+        for (size_t i = 0; i < blocks; i++) {
+            inputShapes.insert(inputShapes.end(), {mhaShape, mhaShape, mhaShape, eltwiseShape, eltwiseShape});
+        }
+        init_input_shapes(inputShapes);
+
+        // Enable Snippets
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::IGNORE_CALLBACK));
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        // The Subgraphs are lowered concurrently
+        configuration.insert(ov::compilation_num_threads(4));
+
+        ov::ParameterVector params;
+        ov::ResultVector results;
+        for (const auto& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+        for (size_t i = 0; i < blocks; i++) {
+            const auto* blockParams = &params[i * 5];
+            const auto matMul0 = std::make_shared<ov::op::v0::MatMul>(blockParams[0], blockParams[1], false, true);
+            const auto softMax = std::make_shared<ov::op::v8::Softmax>(matMul0, -1);
+            const auto matMul1 = std::make_shared<ov::op::v0::MatMul>(softMax, blockParams[2]);
+            results.push_back(std::make_shared<ov::op::v0::Result>(matMul1));
+
+            const auto add = std::make_shared<ov::op::v1::Add>(blockParams[3], blockParams[4]);
+            const auto multiply = std::make_shared<ov::op::v1::Multiply>(add, blockParams[3]);
+            const auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+            results.push_back(std::make_shared<ov::op::v0::Result>(relu));
+        }
+        function = std::make_shared<ov::Model>(results, params, "SubgraphSharedLowering");
+    }
+
+    void checkLoweredBodies(size_t blocks) {
+        size_t ownBodies = 0;
+        size_t sharedBodies = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "Subgraph") {
+                continue;
+            }
+            const auto loweredBody = rtInfo.at("lowered_body").as<std::string>();
+            if (loweredBody == "own") {
+                ownBodies++;
+            } else if (loweredBody == "shared") {
+                sharedBodies++;
+            }
+        }
+        // the MHA and the eltwise bodies are lowered once each
+        ASSERT_EQ(ownBodies, 2U);
+        ASSERT_EQ(sharedBodies, 2 * (blocks - 1));
+    }
+};
+
+TEST_P(SubgraphSharedLoweringTest, CompareWithRefs) {
+    run();
+
+    const auto blocks = std::get<2>(GetParam());
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 0);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Subgraph", 2 * blocks);
+    checkLoweredBodies(blocks);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_SubgraphSharedLowering_Static,
+                         SubgraphSharedLoweringTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 4, 32, 16}}}),
+                                            ::testing::Values(InputShape{{}, {{2, 3, 17, 29}}}),
+                                            ::testing::Values(1, 4)),
+                         SubgraphSharedLoweringTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_SubgraphSharedLowering_Dynamic,
+    SubgraphSharedLoweringTest,
+    ::testing::Combine(
+        ::testing::Values(InputShape{{-1, 4, -1, 16}, {{1, 4, 32, 16}, {2, 4, 7, 16}, {1, 4, 32, 16}}}),
+        ::testing::Values(InputShape{{-1, 3, -1, 29}, {{2, 3, 17, 29}, {1, 3, 5, 29}, {2, 3, 17, 29}}}),
+        ::testing::Values(1, 4)),
+    SubgraphSharedLoweringTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
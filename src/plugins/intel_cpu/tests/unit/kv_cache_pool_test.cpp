@@ -0,0 +1,235 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_shape.h"
+#include "kv_cache_offload_storage.h"
+#include "kv_cache_pool.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<VariableStateKVcache> makeState(const std::string& name,
+                                                const KVCachePool::Ptr& pool,
+                                                ov::element::Type precision = ov::element::f32) {
+    // [B, H, L, S], stored as [L, B, H, S]
+    const Shape shape(ov::PartialShape{-1, 2, -1, 8});
+    auto externalDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, shape);
+    auto internalDesc = ArbitraryOrderDescCreator({2, 0, 1, 3}).createSharedDesc(precision, shape);
+    // the u8 cache is quantized by token in the groups of 4 channels
+    const size_t groupSize = precision == ov::element::u8 ? 4 : 0;
+    return std::make_shared<VariableStateKVcache>(name, externalDesc, internalDesc, false, groupSize, pool);
+}
+
+ov::Tensor makeData(float start) {
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1, 2, 4, 8});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = start + static_cast<float>(i);
+    }
+    return tensor;
+}
+
+void checkState(const VariableStateKVcache& state, const ov::Tensor& expected) {
+    const auto actual = state.get_state();
+    ASSERT_EQ(actual->get_shape(), expected.get_shape());
+    const auto* actualData = static_cast<const float*>(actual->data());
+    const auto* expectedData = expected.data<const float>();
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        ASSERT_EQ(actualData[i], expectedData[i]);
+    }
+}
+
+}  // namespace
+
+TEST(KVCachePoolTests, OffloadLeastRecentlyUsed) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto first = makeState("first", pool);
+    auto second = makeState("second", pool);
+    const auto firstData = makeData(0.0F);
+    const auto secondData = makeData(1000.0F);
+    first->set_state(ov::get_tensor_impl(firstData));
+    second->set_state(ov::get_tensor_impl(secondData));
+
+    const auto size = first->allocated_size();
+    ASSERT_GT(size, 0);
+    ASSERT_EQ(pool->getStatistics().used_size, 2 * size);
+
+    const std::vector<VariableStateKVcache*> firstStates{first.get()};
+    const std::vector<VariableStateKVcache*> secondStates{second.get()};
+    { KVCachePool::Pin pin(pool, firstStates); }
+
+    // only one state fits, the least recently used one is offloaded
+    pool->setBudget(size);
+    ASSERT_FALSE(first->is_offloaded());
+    ASSERT_TRUE(second->is_offloaded());
+    auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.used_size, size);
+    ASSERT_EQ(statistics.offloads, 1);
+    ASSERT_GT(statistics.offloaded_size, 0);
+    checkState(*second, secondData);
+
+    {
+        KVCachePool::Pin pin(pool, secondStates);
+        ASSERT_FALSE(second->is_offloaded());
+        ASSERT_TRUE(first->is_offloaded());
+    }
+    statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.offloads, 2);
+    ASSERT_EQ(statistics.restores, 1);
+    checkState(*first, firstData);
+    checkState(*second, secondData);
+}
+
+TEST(KVCachePoolTests, PinnedStatesAreNotOffloaded) {
+    auto pool = std::make_shared<KVCachePool>(1);
+    auto first = makeState("first", pool);
+    auto second = makeState("second", pool);
+    const std::vector<VariableStateKVcache*> states{first.get(), second.get()};
+    {
+        KVCachePool::Pin pin(pool, states);
+        first->set_state(ov::get_tensor_impl(makeData(0.0F)));
+        second->set_state(ov::get_tensor_impl(makeData(1000.0F)));
+        ASSERT_FALSE(first->is_offloaded());
+        ASSERT_FALSE(second->is_offloaded());
+        ASSERT_EQ(pool->getStatistics().used_size, first->allocated_size() + second->allocated_size());
+    }
+    // the budget is exceeded by the idle states now
+    ASSERT_TRUE(first->is_offloaded());
+    ASSERT_TRUE(second->is_offloaded());
+    ASSERT_EQ(pool->getStatistics().used_size, 0);
+}
+
+TEST(KVCachePoolTests, ResetDropsOffloadedData) {
+    auto pool = std::make_shared<KVCachePool>(1);
+    auto state = makeState("state", pool);
+    state->set_state(ov::get_tensor_impl(makeData(0.0F)));
+    ASSERT_TRUE(state->is_offloaded());
+    state->reset();
+    ASSERT_FALSE(state->is_offloaded());
+    ASSERT_EQ(pool->getStatistics().offloaded_size, 0);
+}
+
+TEST(KVCachePoolTests, NoBudgetKeepsStates) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto state = makeState("state", pool);
+    state->set_state(ov::get_tensor_impl(makeData(0.0F)));
+    const std::vector<VariableStateKVcache*> states{state.get()};
+    { KVCachePool::Pin pin(pool, states); }
+    ASSERT_FALSE(state->is_offloaded());
+    const auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.used_size, state->allocated_size());
+    ASSERT_EQ(statistics.offloads, 0);
+}
+
+TEST(KVCachePoolTests, QuantizedStateIsOffloadedExactly) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto state = makeState("state", pool, ov::element::u8);
+    state->set_state(ov::get_tensor_impl(makeData(0.0F)));
+    // the dequantized data, the offloading must neither requantize nor lose them
+    const auto expected = ov::make_tensor(state->get_state());
+
+    pool->setBudget(1);
+    ASSERT_TRUE(state->is_offloaded());
+    checkState(*state, expected);
+
+    const std::vector<VariableStateKVcache*> states{state.get()};
+    {
+        KVCachePool::Pin pin(pool, states);
+        ASSERT_FALSE(state->is_offloaded());
+        checkState(*state, expected);
+    }
+    ASSERT_TRUE(state->is_offloaded());
+    checkState(*state, expected);
+    ASSERT_EQ(pool->getStatistics().restores, 1);
+}
+
+TEST(KVCachePoolTests, OffloadBudgetKeepsStatesInMemory) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto first = makeState("first", pool);
+    auto second = makeState("second", pool);
+    const auto firstData = makeData(0.0F);
+    const auto secondData = makeData(1000.0F);
+    first->set_state(ov::get_tensor_impl(firstData));
+    second->set_state(ov::get_tensor_impl(secondData));
+    const std::vector<VariableStateKVcache*> secondStates{second.get()};
+    { KVCachePool::Pin pin(pool, secondStates); }
+
+    // the offloaded size of a state with the same data
+    auto probePool = std::make_shared<KVCachePool>(1);
+    auto probe = makeState("probe", probePool);
+    probe->set_state(ov::get_tensor_impl(firstData));
+    ASSERT_TRUE(probe->is_offloaded());
+
+    // the offload file takes one state only, the other one stays in memory over the budget
+    pool->setOffloadBudget(probe->offloaded_size());
+    pool->setBudget(1);
+    ASSERT_TRUE(first->is_offloaded());
+    ASSERT_FALSE(second->is_offloaded());
+    const auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.used_size, second->allocated_size());
+    ASSERT_EQ(statistics.offloaded_size, first->offloaded_size());
+    ASSERT_EQ(statistics.offloads, 1);
+    checkState(*first, firstData);
+    checkState(*second, secondData);
+}
+
+TEST(KVCachePoolTests, OffloadReleasesMemory) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto state = makeState("state", pool);
+    state->set_state(ov::get_tensor_impl(makeData(0.0F)));
+    pool->setBudget(1);
+    ASSERT_TRUE(state->is_offloaded());
+    // the offloaded data are kept in the file only
+    ASSERT_EQ(state->allocated_size(), 0);
+    ASSERT_EQ(pool->getStatistics().used_size, 0);
+}
+
+TEST(KVCacheOffloadStorageTests, ReleasedExtentsAreReused) {
+    KVCacheOffloadStorage storage("");
+    const auto first = storage.allocate(16);
+    const auto second = storage.allocate(32);
+    const auto third = storage.allocate(16);
+    ASSERT_EQ(first.offset, 0);
+    ASSERT_EQ(second.offset, 16);
+    ASSERT_EQ(third.offset, 48);
+
+    const std::vector<uint8_t> data{1, 2, 3, 4, 5, 6, 7, 8};
+    storage.write(third, 8, data.data(), data.size());
+
+    // the adjacent released extents are merged
+    storage.release(first);
+    storage.release(second);
+    const auto merged = storage.allocate(40);
+    ASSERT_EQ(merged.offset, 0);
+    const auto rest = storage.allocate(8);
+    ASSERT_EQ(rest.offset, 40);
+    const auto appended = storage.allocate(8);
+    ASSERT_EQ(appended.offset, 64);
+
+    std::vector<uint8_t> actual(data.size());
+    storage.read(third, 8, actual.data(), actual.size());
+    ASSERT_EQ(actual, data);
+    ASSERT_ANY_THROW(storage.read(third, 12, actual.data(), actual.size()));
+}
+
+TEST(KVCachePoolTests, UnregisterOnDestruction) {
+    auto pool = std::make_shared<KVCachePool>();
+    auto state = makeState("state", pool);
+    state->set_state(ov::get_tensor_impl(makeData(0.0F)));
+    ASSERT_GT(pool->getStatistics().used_size, 0);
+    state.reset();
+    ASSERT_EQ(pool->getStatistics().used_size, 0);
+}
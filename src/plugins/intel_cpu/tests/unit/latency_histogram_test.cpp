@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "perf_count.h"
+
+using namespace ov::intel_cpu;
+
+TEST(LatencyHistogramTests, BucketBoundsCoverValues) {
+    for (uint64_t value = 0; value < (1U << 20); value += 7) {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        const auto upperBound = LatencyHistogram::bucketUpperBound(index);
+        ASSERT_LE(value, upperBound);
+        // the relative precision of the bucket is 1/16
+        ASSERT_LE(upperBound - value, value / 16);
+        if (index > 0) {
+            ASSERT_LT(LatencyHistogram::bucketUpperBound(index - 1), value);
+        }
+    }
+}
+
+TEST(LatencyHistogramTests, Percentiles) {
+    LatencyHistogram histogram;
+    ASSERT_EQ(histogram.percentile(99.0), 0);
+    for (uint64_t i = 1; i <= 1000; i++) {
+        histogram.record(i * 1000);
+    }
+    ASSERT_EQ(histogram.count(), 1000);
+    ASSERT_EQ(histogram.min(), 1000);
+    ASSERT_EQ(histogram.max(), 1000000);
+    ASSERT_EQ(histogram.mean(), 500500);
+    const auto p50 = histogram.percentile(50.0);
+    ASSERT_GE(p50, 500000);
+    ASSERT_LE(p50, 500000 + 500000 / 16);
+    const auto p99 = histogram.percentile(99.0);
+    ASSERT_GE(p99, 990000);
+    ASSERT_LE(p99, 1000000);
+    ASSERT_EQ(histogram.percentile(100.0), 1000000);
+}
+
+TEST(LatencyHistogramTests, Merge) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(10);
+    second.record(1000000);
+    second.record(20);
+    first.merge(second);
+    ASSERT_EQ(first.count(), 3);
+    ASSERT_EQ(first.min(), 10);
+    ASSERT_EQ(first.max(), 1000000);
+    ASSERT_EQ(first.buckets().size(), 3);
+}
+
+TEST(LatencyHistogramTests, Dump) {
+    NodeLatencyRecord record{"conv", "Convolution", "jit_avx2", {}};
+    record.profile.execute.record(2000);
+    record.profile.prepareParams.record(5000);
+    const auto dump = dumpLatencyProfiles({record});
+    ASSERT_EQ(dump,
+              "node_name;node_type;exec_type;stage;count;min_us;mean_us;p50_us;p90_us;p99_us;p99.9_us;max_us;buckets\n"
+              "conv;Convolution;jit_avx2;execute;1;2.000;2.000;2.000;2.000;2.000;2.000;2.000;2047:1\n"
+              "conv;Convolution;jit_avx2;prepare_params;1;5.000;5.000;5.000;5.000;5.000;5.000;5.000;5119:1\n");
+}
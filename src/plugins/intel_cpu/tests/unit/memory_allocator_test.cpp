@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "internal_properties.hpp"
+#include "memory_allocator.h"
+#include "openvino/runtime/system_conf.hpp"
+
+#if defined(__linux__)
+#    include <unistd.h>
+#endif
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t hugePageSize = MemoryAllocator::hugePageSize;
+
+bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(MemoryAllocatorTest, SmallAllocationsUseRegularPages) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::TRANSPARENT_HUGE_PAGES);
+    {
+        auto data = allocator->allocate(1000, 0);
+        ASSERT_NE(data, nullptr);
+        EXPECT_TRUE(isAligned(data.get(), 64));
+        std::memset(data.get(), 0, 1000);
+
+        const auto statistics = allocator->getStatistics();
+        EXPECT_EQ(statistics.allocations, 1U);
+        EXPECT_EQ(statistics.allocated_size, 1000U);
+        EXPECT_EQ(statistics.transparent_huge_pages_size, 0U);
+        EXPECT_EQ(statistics.huge_pages_size, 0U);
+    }
+    EXPECT_EQ(allocator->getStatistics().allocated_size, 0U);
+    EXPECT_EQ(allocator->getStatistics().peak_allocated_size, 1000U);
+}
+
+#if defined(__linux__)
+TEST(MemoryAllocatorTest, LargeAllocationsUseTransparentHugePages) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::TRANSPARENT_HUGE_PAGES);
+    const size_t size = hugePageSize + 1;
+    {
+        auto data = allocator->allocate(size, 0);
+        ASSERT_NE(data, nullptr);
+        EXPECT_TRUE(isAligned(data.get(), hugePageSize));
+        std::memset(data.get(), 1, size);
+
+        const auto statistics = allocator->getStatistics();
+        EXPECT_EQ(statistics.allocated_size, 2 * hugePageSize);
+        EXPECT_EQ(statistics.transparent_huge_pages_size, 2 * hugePageSize);
+    }
+    const auto statistics = allocator->getStatistics();
+    EXPECT_EQ(statistics.allocated_size, 0U);
+    EXPECT_EQ(statistics.transparent_huge_pages_size, 0U);
+}
+
+TEST(MemoryAllocatorTest, ExplicitHugePagesFallBackToTransparent) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::HUGE_PAGES);
+    {
+        auto data = allocator->allocate(hugePageSize, 0);
+        ASSERT_NE(data, nullptr);
+        EXPECT_TRUE(isAligned(data.get(), hugePageSize));
+        std::memset(data.get(), 1, hugePageSize);
+
+        // the huge pages pool of the machine may be empty
+        const auto statistics = allocator->getStatistics();
+        if (statistics.huge_pages_fallbacks == 0) {
+            EXPECT_EQ(statistics.huge_pages_size, hugePageSize);
+        } else {
+            EXPECT_EQ(statistics.transparent_huge_pages_size, hugePageSize);
+        }
+    }
+    const auto statistics = allocator->getStatistics();
+    EXPECT_EQ(statistics.huge_pages_size, 0U);
+    EXPECT_EQ(statistics.transparent_huge_pages_size, 0U);
+}
+#endif  // __linux__
+
+TEST(MemoryAllocatorTest, DataOutlivesAllocator) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::TRANSPARENT_HUGE_PAGES);
+    std::weak_ptr<MemoryAllocator> allocatorRef = allocator;
+    // both the regular and the huge pages backed allocations, like the memory owned by the tensors of a request
+    auto small = allocator->allocate(256, 0);
+    auto large = allocator->allocate(hugePageSize, 0);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+
+    allocator.reset();
+    ASSERT_TRUE(allocatorRef.expired());
+
+    std::memset(small.get(), 0, 256);
+    std::memset(large.get(), 0, hugePageSize);
+    small.reset();
+    large.reset();
+}
+
+#if defined(__linux__)
+TEST(MemoryAllocatorTest, NumaBindingCoversWholePages) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::NUMA);
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto small = allocator->allocate(pageSize / 2, 0);
+    auto large = allocator->allocate(pageSize + 1, 0);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    std::memset(small.get(), 0, pageSize / 2);
+    std::memset(large.get(), 0, pageSize + 1);
+
+    const auto statistics = allocator->getStatistics();
+    // the binding makes no difference on a single node system, so the allocations stay regular there
+    if (ov::get_num_numa_nodes() > 1) {
+        EXPECT_TRUE(isAligned(large.get(), pageSize));
+        EXPECT_EQ(statistics.allocated_size, pageSize / 2 + 2 * pageSize);
+        // the sub page allocation shares its page with other data, so it is never bound
+        EXPECT_EQ(statistics.numa_bound_size + statistics.numa_bind_failures * 2 * pageSize, 2 * pageSize);
+    } else {
+        EXPECT_EQ(statistics.allocated_size, pageSize / 2 + pageSize + 1);
+        EXPECT_EQ(statistics.numa_bound_size, 0U);
+    }
+}
+#endif  // __linux__
+
+TEST(MemoryAllocatorTest, BlockWithReuseGrowsOnly) {
+    auto allocator = std::make_shared<MemoryAllocator>(MemoryAllocationMode::NUMA);
+    MemoryBlockWithReuse block(0, allocator);
+
+    ASSERT_TRUE(block.resize(256));
+    ASSERT_NE(block.getRawPtr(), nullptr);
+    EXPECT_FALSE(block.resize(128));
+    ASSERT_TRUE(block.resize(4096));
+    std::memset(block.getRawPtr(), 0, 4096);
+    EXPECT_EQ(allocator->getStatistics().allocated_size, 4096U);
+    block.free();
+    EXPECT_EQ(block.getRawPtr(), nullptr);
+    EXPECT_EQ(allocator->getStatistics().allocated_size, 0U);
+}
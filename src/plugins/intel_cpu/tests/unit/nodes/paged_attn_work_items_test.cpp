@@ -0,0 +1,213 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+constexpr size_t block_size = 32;
+constexpr size_t head_size = 16;
+
+struct Batch {
+    PlainTensor q, k, v;
+    PlainTensor past_lens, subsequence_begins, block_indices, block_indices_begins;
+
+    // every token is filled with its id, so the tokens with the same ids produce the identical q, k and v rows
+    Batch(const std::vector<std::vector<float>>& token_ids,
+          const std::vector<int32_t>& past,
+          size_t cache_block_size = block_size) {
+        std::vector<int32_t> begins{0};
+        for (const auto& seq : token_ids) {
+            begins.push_back(begins.back() + static_cast<int32_t>(seq.size()));
+        }
+        const auto tokens = static_cast<size_t>(begins.back());
+        for (auto* t : {&q, &k, &v}) {
+            t->resize<float>({tokens, head_size});
+        }
+        size_t token = 0;
+        for (const auto& seq : token_ids) {
+            for (auto id : seq) {
+                for (size_t s = 0; s < head_size; s++) {
+                    q.ptr<float>(token)[s] = id;
+                    k.ptr<float>(token)[s] = id + 1.0F;
+                    v.ptr<float>(token)[s] = id + 2.0F;
+                }
+                token++;
+            }
+        }
+        past_lens.resize<int32_t>({past.size()});
+        std::copy(past.begin(), past.end(), past_lens.ptr<int32_t>());
+        subsequence_begins.resize<int32_t>({begins.size()});
+        std::copy(begins.begin(), begins.end(), subsequence_begins.ptr<int32_t>());
+
+        std::vector<int32_t> blocks_begins{0};
+        for (size_t i = 0; i < token_ids.size(); i++) {
+            const auto kv_len = static_cast<size_t>(past[i]) + token_ids[i].size();
+            blocks_begins.push_back(blocks_begins.back() + static_cast<int32_t>(div_up(kv_len, cache_block_size)));
+        }
+        block_indices.resize<int32_t>({static_cast<size_t>(blocks_begins.back())});
+        for (int32_t i = 0; i < blocks_begins.back(); i++) {
+            block_indices.ptr<int32_t>()[i] = i;
+        }
+        block_indices_begins.resize<int32_t>({blocks_begins.size()});
+        std::copy(blocks_begins.begin(), blocks_begins.end(), block_indices_begins.ptr<int32_t>());
+    }
+
+    PrefixSharing sharing() const {
+        PrefixSharing sharing;
+        sharing.reset(q, k, v, past_lens, subsequence_begins, block_size);
+        return sharing;
+    }
+};
+
+std::vector<float> make_tokens(size_t count, float first_id) {
+    std::vector<float> ids(count);
+    for (size_t i = 0; i < count; i++) {
+        ids[i] = first_id + static_cast<float>(i);
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(PagedAttnPrefixSharingTest, IdenticalPrompts) {
+    auto prompt = make_tokens(2 * block_size, 0);
+    Batch batch({prompt, prompt, make_tokens(2 * block_size, 1000)}, {0, 0, 0});
+    auto sharing = batch.sharing();
+
+    ASSERT_FALSE(sharing.empty());
+    EXPECT_EQ(sharing.get_leader(0), -1);
+    EXPECT_EQ(sharing.get_leader(1), 0);
+    EXPECT_EQ(sharing.get_shared_blocks(1), 2);
+    EXPECT_EQ(sharing.get_leader(2), -1);
+    EXPECT_EQ(sharing.get_shared_blocks(2), 0);
+}
+
+TEST(PagedAttnPrefixSharingTest, DivergedPrompts) {
+    auto common = make_tokens(block_size, 0);
+    auto first = common;
+    auto second = common;
+    auto first_tail = make_tokens(block_size + 5, 100);
+    auto second_tail = make_tokens(block_size, 200);
+    first.insert(first.end(), first_tail.begin(), first_tail.end());
+    second.insert(second.end(), second_tail.begin(), second_tail.end());
+    Batch batch({first, second}, {0, 0});
+    auto sharing = batch.sharing();
+
+    EXPECT_EQ(sharing.get_leader(1), 0);
+    EXPECT_EQ(sharing.get_shared_blocks(1), 1);
+}
+
+TEST(PagedAttnPrefixSharingTest, FollowerOfFollower) {
+    auto common = make_tokens(block_size, 0);
+    auto longer = make_tokens(2 * block_size, 0);
+    Batch batch({common, longer, longer}, {0, 0, 0});
+    auto sharing = batch.sharing();
+
+    EXPECT_EQ(sharing.get_leader(1), 0);
+    EXPECT_EQ(sharing.get_shared_blocks(1), 1);
+    EXPECT_EQ(sharing.get_leader(2), 1);
+    EXPECT_EQ(sharing.get_shared_blocks(2), 2);
+}
+
+TEST(PagedAttnPrefixSharingTest, SecondTokensAreNotShared) {
+    auto prompt = make_tokens(block_size, 0);
+    Batch batch({prompt, prompt, {7.0F}}, {0, block_size, block_size});
+    auto sharing = batch.sharing();
+
+    EXPECT_TRUE(sharing.empty());
+}
+
+TEST(PagedAttnPrefixSharingTest, SharedBlocksAreSkippedInWorkItems) {
+    auto prompt = make_tokens(2 * block_size, 0);
+    auto extended = prompt;
+    extended.push_back(-1.0F);
+    Batch batch({prompt, prompt, extended}, {0, 0, 0});
+    auto sharing = batch.sharing();
+
+    WorkItems items;
+    items.reset(batch.q,
+                batch.past_lens,
+                batch.subsequence_begins,
+                batch.block_indices,
+                batch.block_indices_begins,
+                block_size,
+                &sharing);
+
+    // the second sequence is completely taken from the first one, the third one computes only its last block
+    EXPECT_EQ(items.get_reorder_max_batch_size(), 2U);
+    EXPECT_EQ(items.reorder_work_size(), 2U + 3U);
+    ASSERT_EQ(items.attn_work_size(), 2U + 1U);
+    EXPECT_EQ(items.get_attn_work_item(2).batch_in_seq, 2);
+    EXPECT_EQ(items.get_attn_work_item(2).q_block_id, 2);
+    EXPECT_EQ(items.get_total_kv_len(), 3 * prompt.size() + 1);
+}
+
+TEST(PagedAttnWorkItemsTest, DraftTokensAreDecodeItems) {
+    // second token, 4 draft tokens to verify and a prompt
+    Batch batch({{1.0F}, make_tokens(4, 10), make_tokens(block_size + 1, 100)}, {40, 70, 0});
+
+    WorkItems items;
+    items.reset(batch.q,
+                batch.past_lens,
+                batch.subsequence_begins,
+                batch.block_indices,
+                batch.block_indices_begins,
+                block_size,
+                nullptr,
+                8);
+
+    // the cache of the draft tokens sequence is not reordered
+    EXPECT_EQ(items.get_reorder_max_batch_size(), 1U);
+    EXPECT_EQ(items.reorder_work_size(), 2U);
+    ASSERT_EQ(items.attn_work_size(), 4U);
+    EXPECT_EQ(items.get_attn_work_item(0).q_len, 1);
+    EXPECT_EQ(items.get_attn_work_item(1).batch_in_seq, 1);
+    EXPECT_EQ(items.get_attn_work_item(1).q_len, 4);
+    EXPECT_EQ(items.get_attn_work_item(2).batch_in_seq, 2);
+
+    // by default only the single token sequences are decode items
+    items.reset(batch.q,
+                batch.past_lens,
+                batch.subsequence_begins,
+                batch.block_indices,
+                batch.block_indices_begins,
+                block_size);
+    EXPECT_EQ(items.get_reorder_max_batch_size(), 2U);
+    EXPECT_EQ(items.reorder_work_size(), 3U + 2U);
+}
+
+TEST(PagedAttnWorkItemsTest, DraftTokensAreLimitedByBlockSize) {
+    // the second token kernels keep one block of query rows per thread, so 6 draft tokens don't fit a block of 4
+    constexpr size_t small_block_size = 4;
+    Batch batch({make_tokens(4, 10), make_tokens(6, 20)}, {40, 70}, small_block_size);
+
+    WorkItems items;
+    items.reset(batch.q,
+                batch.past_lens,
+                batch.subsequence_begins,
+                batch.block_indices,
+                batch.block_indices_begins,
+                small_block_size,
+                nullptr,
+                8);
+
+    EXPECT_EQ(items.get_max_decode_q_len(), small_block_size);
+    EXPECT_EQ(items.get_reorder_max_batch_size(), 1U);
+    EXPECT_EQ(items.reorder_work_size(), (70U + 6U) / small_block_size);
+    ASSERT_EQ(items.attn_work_size(), 1U + 2U);
+    EXPECT_EQ(items.get_attn_work_item(0).batch_in_seq, 0);
+    EXPECT_EQ(items.get_attn_work_item(0).q_len, 4);
+    EXPECT_EQ(items.get_attn_work_item(1).batch_in_seq, 1);
+    EXPECT_EQ(items.get_attn_work_item(1).q_len, 6);
+}
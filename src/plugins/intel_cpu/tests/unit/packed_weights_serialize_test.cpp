@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "utils/codec_xor.hpp"
+#include "utils/serialize.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 16}, std::vector<float>(16, 1.f));
+    constant->set_friendly_name("weights");
+    auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+    return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+}
+
+class PackedWeightsSerializeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_model = make_model();
+        m_data.resize(5000);
+        std::iota(m_data.begin(), m_data.end(), 0);
+        for (const auto& name : {"first", "second"}) {
+            PackedWeights weights;
+            weights.key_prefix = std::string(name) + "_12345_";
+            weights.constant_name = "weights";
+            weights.desc = {0, 1, 0xAB, 0xFF};
+            weights.data = m_data.data();
+            weights.size = m_data.size();
+            m_packed_weights.push_back(weights);
+        }
+    }
+
+    std::string serialize() const {
+        std::stringstream stream;
+        ModelSerializer serializer(stream, {}, {}, m_packed_weights);
+        serializer << m_model;
+        return stream.str();
+    }
+
+    ModelDeserializer::ModelBuilder builder() const {
+        return [this](const std::shared_ptr<ov::AlignedBuffer>&, const std::shared_ptr<ov::AlignedBuffer>&) {
+            return m_model;
+        };
+    }
+
+    void check(const std::vector<PackedWeights>& packed_weights) const {
+        ASSERT_EQ(packed_weights.size(), m_packed_weights.size());
+        for (size_t i = 0; i < packed_weights.size(); ++i) {
+            ASSERT_EQ(packed_weights[i].key_prefix, m_packed_weights[i].key_prefix);
+            ASSERT_EQ(packed_weights[i].constant_name, m_packed_weights[i].constant_name);
+            ASSERT_EQ(packed_weights[i].desc, m_packed_weights[i].desc);
+            ASSERT_EQ(packed_weights[i].size, m_data.size());
+            ASSERT_EQ(std::memcmp(packed_weights[i].data, m_data.data(), m_data.size()), 0);
+            ASSERT_TRUE(packed_weights[i].holder);
+        }
+    }
+
+    std::shared_ptr<ov::Model> m_model;
+    std::vector<uint8_t> m_data;
+    std::vector<PackedWeights> m_packed_weights;
+};
+
+}  // namespace
+
+TEST_F(PackedWeightsSerializeTest, StreamImportCopiesWeights) {
+    std::stringstream stream(serialize());
+    ModelDeserializer deserializer(stream, builder(), CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> model;
+    deserializer >> model;
+
+    check(deserializer.get_packed_weights());
+}
+
+TEST_F(PackedWeightsSerializeTest, MappedImportUsesBlobInPlace) {
+    const auto blob = serialize();
+    constexpr size_t page_size = 4096;
+    // emulate the memory mapped blob, the mapping is always page aligned
+    auto buffer = std::make_shared<ov::AlignedBuffer>(blob.size(), page_size);
+    std::memcpy(buffer->get_ptr(), blob.data(), blob.size());
+    ModelDeserializer deserializer(buffer, builder(), CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> model;
+    deserializer >> model;
+
+    const auto& packed_weights = deserializer.get_packed_weights();
+    check(packed_weights);
+    const auto* begin = buffer->get_ptr<char>();
+    for (const auto& weights : packed_weights) {
+        const auto* data = static_cast<const char*>(weights.data);
+        ASSERT_TRUE(data >= begin && data + weights.size <= begin + blob.size());
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % page_size, 0);
+    }
+}
+
+TEST_F(PackedWeightsSerializeTest, NoPackedWeights) {
+    m_packed_weights.clear();
+    std::stringstream stream(serialize());
+    ModelDeserializer deserializer(stream, builder(), CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> model;
+    deserializer >> model;
+
+    ASSERT_TRUE(deserializer.get_packed_weights().empty());
+}
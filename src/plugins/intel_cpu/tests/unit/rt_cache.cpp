@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,7 +10,10 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
+#include "config.h"
+#include "graph_context.h"
 
 using namespace ov::intel_cpu;
 
@@ -97,6 +101,58 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, EvictionCounter) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getEvicted(), static_cast<size_t>(capacity));
+    OV_ASSERT_NO_THROW(cache.evict(3));
+    ASSERT_EQ(cache.getEvicted(), static_cast<size_t>(capacity + 3));
+}
+
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr int capacity = 64;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.get({capacity + 1}), int());
+    ASSERT_EQ(cache.getCapacity(), static_cast<size_t>(capacity));
+}
+
+TEST(ShardedLruCacheTests, Evict) {
+    constexpr int capacity = 16;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 4 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_GE(cache.getEvicted(), static_cast<size_t>(3 * capacity));
+
+    OV_ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 0; i < 4 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +436,131 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(result.first, IntValueType());
+    }
+    for (int i = 0; i < 2 * capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(result.first, IntValueType());
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, static_cast<uint64_t>(capacity));
+    ASSERT_EQ(statistics.misses, static_cast<uint64_t>(2 * capacity));
+    ASSERT_EQ(statistics.evictions, static_cast<uint64_t>(capacity));
+}
+
+TEST(MultiCacheTests, StatisticsConcurrentWithGetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 10;
+    constexpr int iterations = 1000;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    // the cache of a stream is not thread safe, but its statistics are read by the other threads
+    MultiCache cache(capacity);
+    ASSERT_FALSE(cache.isThreadSafe());
+
+    std::atomic_bool done{false};
+    {
+        ScopedThread reader(std::thread([&]() {
+            uint64_t lastLookups = 0;
+            while (!done.load()) {
+                const auto statistics = cache.getStatistics();
+                const auto lookups = statistics.hits + statistics.misses;
+                ASSERT_GE(lookups, lastLookups);
+                lastLookups = lookups;
+            }
+        }));
+        for (int i = 0; i < iterations; ++i) {
+            EXPECT_NE(cache.getOrCreate(IntKey{i % (2 * capacity)}, intBuilder).first, IntValueType());
+            EXPECT_NE(cache.getOrCreate(StringKey{std::to_string(i % capacity)}, strBuilder).first, StrValueType());
+        }
+        done = true;
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>(2 * iterations));
+    ASSERT_EQ(statistics.misses, static_cast<uint64_t>(iterations + capacity));
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 100;
+    constexpr int numKeys = 50;
+    constexpr size_t numThreads = 16;
+    constexpr int iterations = 20;
+
+    std::atomic_int intBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        intBuilds++;
+        return std::make_shared<int>(key.data);
+    };
+    std::atomic_int strBuilds{0};
+    auto strBuilder = [&](const StringKey& key) {
+        strBuilds++;
+        return std::make_shared<std::string>(key.data);
+    };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < iterations; ++j) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>(2 * numKeys * iterations * numThreads));
+    // each miss leads to exactly one build, the same key may be built concurrently by several threads
+    ASSERT_EQ(statistics.misses, static_cast<uint64_t>(intBuilds.load() + strBuilds.load()));
+    ASSERT_GE(intBuilds.load(), numKeys);
+    ASSERT_GE(strBuilds.load(), numKeys);
+}
+
+TEST(MultiCacheTests, SharedPrimitivesCacheKeepsStreamCachesPrivate) {
+    Config config;
+    auto sharedCache = std::make_shared<MultiCache>(config.rtCacheCapacity, true);
+    const auto firstStream = std::make_shared<GraphContext>(config, nullptr, false, nullptr, nullptr, sharedCache);
+    const auto secondStream = std::make_shared<GraphContext>(config, nullptr, false, nullptr, nullptr, sharedCache);
+
+    // the executors with the mutable scratch state must never be executed by two streams concurrently
+    ASSERT_NE(firstStream->getParamsCache(), secondStream->getParamsCache());
+    ASSERT_EQ(firstStream->getSharedPrimitivesCache(), sharedCache);
+    ASSERT_EQ(secondStream->getSharedPrimitivesCache(), sharedCache);
+
+    const auto standalone = std::make_shared<GraphContext>(config, nullptr, false);
+    ASSERT_EQ(standalone->getSharedPrimitivesCache(), standalone->getParamsCache());
+}
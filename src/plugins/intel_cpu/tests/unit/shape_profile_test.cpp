@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "shape_profile.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(ShapeProfileTests, RecordDistinct) {
+    ShapeProfile profile;
+    ASSERT_TRUE(profile.record({{1, 3, 16, 16}, {1}}));
+    ASSERT_TRUE(profile.record({{1, 3, 32, 32}, {1}}));
+    ASSERT_FALSE(profile.record({{1, 3, 16, 16}, {1}}));
+
+    const auto shapes = profile.get();
+    ASSERT_EQ(shapes.size(), 2);
+    ASSERT_EQ(shapes[0], ShapeProfile::InputShapes({{1, 3, 16, 16}, {1}}));
+    ASSERT_EQ(shapes[1], ShapeProfile::InputShapes({{1, 3, 32, 32}, {1}}));
+}
+
+TEST(ShapeProfileTests, Capacity) {
+    constexpr size_t capacity = 4;
+    ShapeProfile profile(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        profile.record({{1, i}});
+    }
+    ASSERT_TRUE(profile.isFull());
+    ASSERT_EQ(profile.get().size(), capacity);
+}
+
+TEST(ShapeProfileTests, ConcurrentRecord) {
+    constexpr size_t numThreads = 8;
+    constexpr size_t numShapes = 16;
+    ShapeProfile profile;
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&profile]() {
+            for (size_t i = 0; i < numShapes; ++i) {
+                profile.record({{1, i}});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(profile.get().size(), numShapes);
+    ASSERT_FALSE(profile.isFull());
+}
+
+TEST(ShapeBucketsTests, StaticBuckets) {
+    const auto buckets = parseShapeBuckets("[1,128] [1,128];[2,256][2,256];;[1,128],[1,128]");
+    ASSERT_EQ(buckets.size(), 2);
+    ASSERT_EQ(buckets[0], ShapeProfile::InputShapes({{1, 128}, {1, 128}}));
+    ASSERT_EQ(buckets[1], ShapeProfile::InputShapes({{2, 256}, {2, 256}}));
+}
+
+TEST(ShapeBucketsTests, IntervalsExpansion) {
+    const auto buckets = parseShapeBuckets("[1..2,3..16][1..2,3..16,4]");
+    // the same intervals take the same value: {1, 2} x {3, 4, 8, 16}
+    ASSERT_EQ(buckets.size(), 8);
+    ASSERT_EQ(buckets.front(), ShapeProfile::InputShapes({{1, 3}, {1, 3, 4}}));
+    ASSERT_EQ(buckets.back(), ShapeProfile::InputShapes({{2, 16}, {2, 16, 4}}));
+    for (const auto& bucket : buckets) {
+        ASSERT_EQ(bucket[0][0], bucket[1][0]);
+        ASSERT_EQ(bucket[0][1], bucket[1][1]);
+    }
+}
+
+TEST(ShapeBucketsTests, ScalarInput) {
+    const auto buckets = parseShapeBuckets("[4][]");
+    ASSERT_EQ(buckets.size(), 1);
+    ASSERT_EQ(buckets[0], ShapeProfile::InputShapes({{4}, {}}));
+}
+
+TEST(ShapeBucketsTests, Invalid) {
+    ASSERT_THROW(parseShapeBuckets("[1,?]"), ov::Exception);
+    ASSERT_THROW(parseShapeBuckets("[1,128"), ov::Exception);
+    ASSERT_THROW(parseShapeBuckets("[1..1024,1..1024]", 16), ov::Exception);
+}
@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "nodes/executors/common/weight_only_fullyconnected.hpp"
+#include "nodes/kernels/fullyconnected/weight_only_gemm.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct CompressedWeights {
+    std::vector<uint8_t> data;
+    // the integer weights before packing, [N, K]
+    std::vector<int> values;
+    std::vector<float> scales;
+    std::vector<float> zeroPoints;
+};
+
+CompressedWeights makeWeights(ov::element::Type type,
+                              size_t N,
+                              size_t K,
+                              size_t groups,
+                              bool withZeroPoints,
+                              bool halfScales = false) {
+    std::mt19937 generator(42);
+    const size_t bits = type.bitwidth();
+    const bool isSigned = type == ov::element::i8 || type == ov::element::i4;
+    const int low = isSigned ? -(1 << (bits - 1)) : 0;
+    const int high = isSigned ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+    std::uniform_int_distribution<int> weightsDistribution(low, high);
+    std::uniform_real_distribution<float> scalesDistribution(0.01F, 0.1F);
+
+    CompressedWeights weights;
+    weights.values.resize(N * K);
+    weights.data.resize(N * K * bits / 8, 0);
+    for (size_t i = 0; i < N * K; i++) {
+        const int value = weightsDistribution(generator);
+        weights.values[i] = value;
+        const auto raw = static_cast<uint8_t>(value);
+        if (bits == 8) {
+            weights.data[i] = raw;
+        } else {
+            weights.data[i / 2] |= static_cast<uint8_t>((raw & 0x0F) << ((i % 2) * 4));
+        }
+    }
+    weights.scales.resize(N * groups);
+    for (auto& scale : weights.scales) {
+        scale = scalesDistribution(generator);
+        // the f16 scales of the model are exactly representable in the f16 packing
+        if (halfScales) {
+            scale = static_cast<float>(ov::float16(scale));
+        }
+    }
+    if (withZeroPoints) {
+        weights.zeroPoints.resize(N * groups);
+        for (auto& zeroPoint : weights.zeroPoints) {
+            zeroPoint = static_cast<float>(weightsDistribution(generator));
+        }
+    }
+    return weights;
+}
+
+std::vector<float> makeSrc(size_t size) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-1.0F, 1.0F);
+    std::vector<float> src(size);
+    for (auto& value : src) {
+        value = distribution(generator);
+    }
+    return src;
+}
+
+std::vector<uint8_t> pack(const CompressedWeights& weights, ov::element::Type type, const WeightOnlyGemmLayout& layout) {
+    std::vector<uint8_t> packed(layout.size());
+    WeightOnlyFCExecutor::packWeights(layout,
+                                      weights.data.data(),
+                                      type,
+                                      weights.scales.data(),
+                                      weights.zeroPoints.empty() ? nullptr : weights.zeroPoints.data(),
+                                      packed.data());
+    return packed;
+}
+
+using WeightOnlyGemmParams = std::
+    tuple<ov::element::Type, size_t /* M */, size_t /* groups */, bool /* zero points */, bool /* f16 params */>;
+
+class WeightOnlyGemmTest : public ::testing::TestWithParam<WeightOnlyGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightOnlyGemmParams>& obj) {
+        const auto& [type, M, groups, withZeroPoints, halfParams] = obj.param;
+        return type.get_type_name() + "_M" + std::to_string(M) + "_G" + std::to_string(groups) +
+               (withZeroPoints ? "_zp" : "") + (halfParams ? "_f16" : "_f32");
+    }
+};
+
+TEST_P(WeightOnlyGemmTest, MatchesReference) {
+    const auto& [type, M, groups, withZeroPoints, halfParams] = GetParam();
+    // N is not a multiple of the block to cover the tail
+    const size_t N = 37;
+    const size_t K = 64;
+    const size_t groupSize = K / groups;
+    const auto weights = makeWeights(type, N, K, groups, withZeroPoints, halfParams);
+    const auto src = makeSrc(M * K);
+    const auto bias = makeSrc(N);
+
+    const WeightOnlyGemmLayout layout(N, K, groups, type.bitwidth(), halfParams ? 2 : 4);
+    const auto packed = pack(weights, type, layout);
+    std::vector<float> dst(M * N, 0.0F);
+    ov::Extensions::Cpu::XARCH::weight_only_gemm(packed.data(), layout, src.data(), M, bias.data(), dst.data());
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            float expected = bias[n];
+            for (size_t k = 0; k < K; k++) {
+                const size_t param = n * groups + k / groupSize;
+                const float zeroPoint = withZeroPoints ? weights.zeroPoints[param] : 0.0F;
+                const float weight = (static_cast<float>(weights.values[n * K + k]) - zeroPoint) * weights.scales[param];
+                expected += src[m * K + k] * weight;
+            }
+            ASSERT_NEAR(dst[m * N + n], expected, 1e-3F * std::max(1.0F, std::fabs(expected)))
+                << "m = " << m << ", n = " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightOnlyGemm,
+                         WeightOnlyGemmTest,
+                         ::testing::Combine(::testing::Values(ov::element::u8,
+                                                              ov::element::i8,
+                                                              ov::element::u4,
+                                                              ov::element::i4),
+                                            ::testing::Values(1, 3, 8),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(false, true)),
+                         WeightOnlyGemmTest::getTestCaseName);
+
+/**
+ * The packing replaces the dnnl one, so its size is the weights footprint of the node: the compressed weights plus the
+ * scale and the zero point per group and output channel, in f16 if the params of the model are f16.
+ */
+TEST(WeightOnlyGemmLayoutTest, PackedFootprint) {
+    const size_t N = 11008;
+    const size_t K = 4096;
+    const size_t groups = K / 128;
+
+    const WeightOnlyGemmLayout u4(N, K, groups, 4, sizeof(ov::float16));
+    const size_t u4Weights = N * K / 2;
+    ASSERT_EQ(u4.size(), u4Weights + N * groups * 2 * sizeof(ov::float16));
+    // +6.25% over the u4 weights with the group of 128, +12.5% with the f32 params
+    ASSERT_DOUBLE_EQ(static_cast<double>(u4.size()) / u4Weights, 1.0625);
+    ASSERT_DOUBLE_EQ(static_cast<double>(WeightOnlyGemmLayout(N, K, groups, 4).size()) / u4Weights, 1.125);
+
+    const WeightOnlyGemmLayout u8(N, K, groups, 8, sizeof(ov::float16));
+    const size_t u8Weights = N * K;
+    ASSERT_DOUBLE_EQ(static_cast<double>(u8.size()) / u8Weights, 1.03125);
+}
+
+}  // namespace
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryPtr makeMemory(const dnnl::engine& eng, float value) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4, 4});
+    auto memory = std::make_shared<Memory>(eng, desc);
+    auto* data = memory->getDataAs<float>();
+    for (size_t i = 0; i < 16; i++) {
+        data[i] = value;
+    }
+    return memory;
+}
+
+}  // namespace
+
+TEST(WeightsSharingTests, ContentStoreSharesEqualWeights) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto contentStore = std::make_shared<WeightsSharing>();
+    auto first = std::make_shared<WeightsSharing>(contentStore);
+    auto second = std::make_shared<WeightsSharing>(contentStore);
+
+    // the same content in the different memory objects, like the constants of two compiled models
+    MemoryCPtr firstSource = makeMemory(eng, 1.0F);
+    MemoryCPtr secondSource = makeMemory(eng, 1.0F);
+    size_t creations = 0;
+    auto create = [&]() {
+        creations++;
+        return makeMemory(eng, 1.0F);
+    };
+    auto contentKey = []() {
+        return std::string("content");
+    };
+
+    auto firstPacked = MemoryPtr(*first->findOrCreate("first", contentKey, firstSource, create));
+    auto secondPacked = MemoryPtr(*second->findOrCreate("second", contentKey, secondSource, create));
+    ASSERT_EQ(firstPacked, secondPacked);
+    ASSERT_EQ(creations, 1);
+}
+
+TEST(WeightsSharingTests, ContentStoreComparesBytes) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto contentStore = std::make_shared<WeightsSharing>();
+    auto first = std::make_shared<WeightsSharing>(contentStore);
+    auto second = std::make_shared<WeightsSharing>(contentStore);
+
+    MemoryCPtr firstSource = makeMemory(eng, 1.0F);
+    MemoryCPtr secondSource = makeMemory(eng, 2.0F);
+    auto create = [&]() {
+        return makeMemory(eng, 0.0F);
+    };
+    // a hash collision: the different contents have the same content key
+    auto contentKey = []() {
+        return std::string("collision");
+    };
+
+    auto firstPacked = MemoryPtr(*first->findOrCreate("first", contentKey, firstSource, create));
+    auto secondPacked = MemoryPtr(*second->findOrCreate("second", contentKey, secondSource, create));
+    ASSERT_NE(firstPacked, secondPacked);
+}
+
+TEST(WeightsSharingTests, ContentKeyIsComputedOnLocalMiss) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto cache = std::make_shared<WeightsSharing>(std::make_shared<WeightsSharing>());
+
+    MemoryCPtr source = makeMemory(eng, 1.0F);
+    size_t contentKeys = 0;
+    auto contentKey = [&]() {
+        contentKeys++;
+        return std::string("content");
+    };
+    auto create = [&]() {
+        return makeMemory(eng, 1.0F);
+    };
+
+    auto packed = MemoryPtr(*cache->findOrCreate("local", contentKey, source, create));
+    ASSERT_EQ(contentKeys, 1);
+    ASSERT_EQ(MemoryPtr(*cache->findOrCreate("local", contentKey, source, create)), packed);
+    ASSERT_EQ(contentKeys, 1);
+}
+
+TEST(WeightsSharingTests, ContentStoreCreatesOutsideOfItsLock) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto contentStore = std::make_shared<WeightsSharing>();
+    auto first = std::make_shared<WeightsSharing>(contentStore);
+    auto second = std::make_shared<WeightsSharing>(contentStore);
+
+    MemoryCPtr source = makeMemory(eng, 1.0F);
+    std::promise<void> started;
+    std::promise<void> proceed;
+    auto slowCreation = std::async(std::launch::async, [&]() {
+        return MemoryPtr(*first->findOrCreate(
+            "slow",
+            []() {
+                return std::string("slow");
+            },
+            source,
+            [&]() {
+                started.set_value();
+                proceed.get_future().wait();
+                return makeMemory(eng, 1.0F);
+            }));
+    });
+    started.get_future().wait();
+
+    // the other weights are created while the slow ones are being repacked
+    auto other = MemoryPtr(*second->findOrCreate(
+        "other",
+        []() {
+            return std::string("other");
+        },
+        source,
+        [&]() {
+            return makeMemory(eng, 2.0F);
+        }));
+    ASSERT_NE(other, nullptr);
+
+    proceed.set_value();
+    ASSERT_NE(slowCreation.get(), nullptr);
+}
+
+TEST(WeightsSharingTests, ContentStoreConcurrentMissesCreateOnce) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto contentStore = std::make_shared<WeightsSharing>();
+    MemoryCPtr source = makeMemory(eng, 1.0F);
+    std::atomic<size_t> creations{0};
+
+    constexpr size_t threadsNum = 8;
+    std::vector<std::shared_ptr<WeightsSharing>> caches;
+    std::vector<MemoryPtr> packed(threadsNum);
+    for (size_t i = 0; i < threadsNum; i++) {
+        caches.push_back(std::make_shared<WeightsSharing>(contentStore));
+    }
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i]() {
+            packed[i] = MemoryPtr(*caches[i]->findOrCreate(
+                "local",
+                []() {
+                    return std::string("content");
+                },
+                source,
+                [&]() {
+                    creations++;
+                    return makeMemory(eng, 1.0F);
+                }));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(creations, 1);
+    for (const auto& memory : packed) {
+        ASSERT_EQ(memory, packed.front());
+    }
+}